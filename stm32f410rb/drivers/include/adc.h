@@ -0,0 +1,175 @@
+/***************************************************************************************************
+ * @file        adc.h
+ * @defgroup    adc adc.h
+ *
+ * @brief       Header file for the ADC driver.
+ *
+ * @details     This file provides continuous scan conversions of ADC1 into a circular buffer in
+ *              RAM, written by DMA2 stream 0 without any CPU intervention:
+ *
+ *              - The regular sequence converts 1 to 16 channels on every trigger (scan mode).
+ *              - The trigger is either the CC1 event of TIM5, for a fixed sequence rate, or the
+ *                end of the previous sequence (continuous mode), for the highest rate.
+ *              - The buffer is split in two halves. The DMA half-transfer and transfer-complete
+ *                interrupts call the handler with the half that was just filled, while the DMA
+ *                fills the other one, so the handler has the time of a half buffer to process it.
+ *
+ *              The ADC clock is PCLK2 divided by the smallest prescaler that keeps it within 36
+ *              MHz. A 12-bit conversion takes the sample time plus 12 ADC clock cycles, so with the
+ *              shortest sample time the ADC reaches 2.4 MSPS with PCLK2 at 72 MHz, 2.13 MSPS at 64
+ *              MHz (kPerfBalanced) and 1.67 MSPS at 100 MHz (kPerfMax, prescaler 4).
+ *
+ *              Channels 0-7 are PA0-PA7, 8-9 are PB0-PB1 and 10-15 are PC0-PC5, which are set to
+ *              analog mode. Channel 16 is the temperature sensor, 17 VREFINT and 18 VBAT / 4.
+ *
+ * @note        The peripheral clocks are read from the performance profile (perf.h), so the
+ *              profile must not change while the ADC is running. An overrun (a conversion not
+ *              read by the DMA in time) restarts the buffer from the start of its first half and
+ *              is counted by adcOverruns(). A DMA transfer error does the same and is counted by
+ *              adcDmaErrors().
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ADC_H
+#define ADC_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    adc_def ADC Definitions
+ * @ingroup     adc
+ * @{
+ */
+#define ADC_MAX_SEQUENCE    (16U)                         /**< Channels per sequence */
+#define ADC_CHANNELS        (19U)                         /**< Channels 0 .. 18 */
+#define ADC_MAX_CLOCK_HZ    (36000000UL)                  /**< Maximum ADC clock (VDDA >= 2.4 V) */
+#define ADC_MAX_HALF_LENGTH (32767U)                      /**< The whole buffer fits in NDTR */
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Sample times, in ADC clock cycles. Longer times suit sources with a higher
+ *              impedance (and the internal channels, which need at least 10 us).
+ *
+ * @ingroup     adc
+ */
+typedef enum {
+  kAdcSample3 = 0,
+  kAdcSample15,
+  kAdcSample28,
+  kAdcSample56,
+  kAdcSample84,
+  kAdcSample112,
+  kAdcSample144,
+  kAdcSample480
+} AdcSampleTime;
+
+
+/***************************************************************************************************
+ * @brief       Handler of a filled half buffer, called from the DMA interrupt.
+ *
+ * @details     The samples are in sequence order, one sequence after another (count is a
+ *              multiple of the sequence length). They stay valid until the DMA gets back to them,
+ *              one half buffer later.
+ *
+ * @ingroup     adc
+ */
+typedef void (*AdcHandler)(const uint16_t *samples, uint32_t count);
+
+
+/**
+ * @defgroup    adc_func ADC Functions
+ * @ingroup     adc
+ */
+
+
+/***************************************************************************************************
+ * @brief       Configures the regular sequence, the DMA buffer and the handler. The conversions
+ *              start with adcStart().
+ *
+ * @param       channels      The channels of the sequence, in conversion order. (0 - 18)
+ * @param       count         Number of channels in the sequence. (1 - ADC_MAX_SEQUENCE)
+ * @param       sample_time   Sample time of every channel of the sequence.
+ * @param       buffer        Buffer of 2 * half_length samples, written by the DMA.
+ * @param       half_length   Samples per half buffer, a multiple of count.
+ *                            (1 - ADC_MAX_HALF_LENGTH)
+ * @param       priority      The priority of the DMA interrupt. (0 - 15)
+ * @param       handler       Handler of every filled half buffer.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     adc_func
+ */
+int adcInit(const uint8_t *channels, uint8_t count, AdcSampleTime sample_time, uint16_t *buffer,
+            uint16_t half_length, uint8_t priority, AdcHandler handler);
+
+
+/***************************************************************************************************
+ * @brief       Starts the conversions from the start of the buffer.
+ *
+ * @param       rate_hz   Sequences per second, generated by TIM5, or 0 to convert continuously at
+ *                        the highest rate of the ADC.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     adc_func
+ */
+int adcStart(uint32_t rate_hz);
+
+
+/***************************************************************************************************
+ * @brief       Stops the conversions and the trigger timer. A half buffer being filled is lost.
+ *
+ * @ingroup     adc_func
+ */
+void adcStop(void);
+
+
+/***************************************************************************************************
+ * @brief       Returns the highest sequence rate in Hz that the ADC can sustain with the current
+ *              configuration and clocks, which is the rate of continuous mode.
+ *
+ * @ingroup     adc_func
+ */
+uint32_t adcMaxRate(void);
+
+
+/***************************************************************************************************
+ * @brief       Returns the number of overruns since adcInit().
+ *
+ * @ingroup     adc_func
+ */
+uint32_t adcOverruns(void);
+
+
+/***************************************************************************************************
+ * @brief       Returns the number of DMA transfer errors since adcInit().
+ *
+ * @ingroup     adc_func
+ */
+uint32_t adcDmaErrors(void);
+
+
+#endif
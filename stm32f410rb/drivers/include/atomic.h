@@ -0,0 +1,238 @@
+/***************************************************************************************************
+ * @file        atomic.h
+ * @defgroup    atomic atomic.h
+ *
+ * @brief       Header file for the atomic operations and critical sections.
+ *
+ * @details     This file provides inline primitives to share data between the main code and the
+ *              interrupt handlers:
+ *
+ *              - Atomic operations on 32-bit variables in SRAM, built on LDREX/STREX. They never
+ *                mask interrupts: if an interrupt touches the variable between the load and the
+ *                store, the exception return clears the exclusive monitor, the store fails and the
+ *                operation is retried. Each one is a single asm block, so the compiler cannot
+ *                place a stack access between LDREX and STREX.
+ *
+ *              - Critical sections based on BASEPRI, which mask only the interrupts with a
+ *                priority value greater than or equal to a given level. Entering one costs a
+ *                couple of instructions, and interrupts with a more urgent priority keep being
+ *                serviced with their usual latency.
+ *
+ *              Drivers protect their state with criticalEnter(CRITICAL_DRIVER_PRIORITY), so
+ *              interrupts of priority 0 are never delayed by them but must not call drivers.
+ *
+ * @note        Atomic operations must not be used on peripheral registers, exclusive accesses are
+ *              only defined for normal memory. Use a critical section for read-modify-write
+ *              sequences on registers instead.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    atomic_def Atomic Definitions
+ * @ingroup     atomic
+ * @{
+ */
+#define CRITICAL_DRIVER_PRIORITY    (1U)    /**< Most urgent priority masked by the drivers */
+/** @} */
+
+
+/**
+ * @defgroup    atomic_func Atomic Functions
+ * @ingroup     atomic
+ */
+
+
+/***************************************************************************************************
+ * @brief       Atomically adds a value to a variable.
+ *
+ * @return      The new value of the variable.
+ *
+ * @ingroup     atomic_func
+ */
+static inline uint32_t atomicAdd(volatile uint32_t *variable, uint32_t value) {
+  uint32_t result, failed;
+
+  asm volatile(
+    "1:\n"
+    "ldrex %[result], [%[variable]]\n"
+    "add %[result], %[result], %[value]\n"
+    "strex %[failed], %[result], [%[variable]]\n"
+    "cmp %[failed], #0\n"
+    "bne 1b\n"                       // Exclusive access lost, try again
+    : [result] "=&r" (result), [failed] "=&r" (failed)
+    : [variable] "r" (variable), [value] "r" (value)
+    : "cc", "memory");
+
+  return result;
+}
+
+
+/***************************************************************************************************
+ * @brief       Atomically replaces a variable by desired if it still holds expected.
+ *
+ * @return      1 if the variable was replaced, 0 if it held another value.
+ *
+ * @ingroup     atomic_func
+ */
+static inline int atomicCas(volatile uint32_t *variable, uint32_t expected, uint32_t desired) {
+  uint32_t current, failed;
+
+  asm volatile(
+    "1:\n"
+    "ldrex %[current], [%[variable]]\n"
+    "cmp %[current], %[expected]\n"
+    "bne 2f\n"                       // Another value, give up the exclusive access
+    "strex %[failed], %[desired], [%[variable]]\n"
+    "cmp %[failed], #0\n"
+    "bne 1b\n"                       // Exclusive access lost, try again
+    "b 3f\n"
+    "2:\n"
+    "clrex\n"
+    "3:\n"
+    : [current] "=&r" (current), [failed] "=&r" (failed)
+    : [variable] "r" (variable), [expected] "r" (expected), [desired] "r" (desired)
+    : "cc", "memory");
+
+  return current == expected;
+}
+
+
+/***************************************************************************************************
+ * @brief       Atomically sets the bits of mask in a variable.
+ *
+ * @return      The value of the variable before the operation.
+ *
+ * @ingroup     atomic_func
+ */
+static inline uint32_t atomicSetBits(volatile uint32_t *variable, uint32_t mask) {
+  uint32_t old, new, failed;
+
+  asm volatile(
+    "1:\n"
+    "ldrex %[old], [%[variable]]\n"
+    "orr %[new], %[old], %[mask]\n"
+    "strex %[failed], %[new], [%[variable]]\n"
+    "cmp %[failed], #0\n"
+    "bne 1b\n"                       // Exclusive access lost, try again
+    : [old] "=&r" (old), [new] "=&r" (new), [failed] "=&r" (failed)
+    : [variable] "r" (variable), [mask] "r" (mask)
+    : "cc", "memory");
+
+  return old;
+}
+
+
+/***************************************************************************************************
+ * @brief       Atomically clears the bits of mask in a variable.
+ *
+ * @return      The value of the variable before the operation.
+ *
+ * @ingroup     atomic_func
+ */
+static inline uint32_t atomicClearBits(volatile uint32_t *variable, uint32_t mask) {
+  uint32_t old, new, failed;
+
+  asm volatile(
+    "1:\n"
+    "ldrex %[old], [%[variable]]\n"
+    "bic %[new], %[old], %[mask]\n"
+    "strex %[failed], %[new], [%[variable]]\n"
+    "cmp %[failed], #0\n"
+    "bne 1b\n"                       // Exclusive access lost, try again
+    : [old] "=&r" (old), [new] "=&r" (new), [failed] "=&r" (failed)
+    : [variable] "r" (variable), [mask] "r" (mask)
+    : "cc", "memory");
+
+  return old;
+}
+
+
+/***************************************************************************************************
+ * @brief       Masks the interrupts with a priority value greater than or equal to priority.
+ *
+ * @details     Uses BASEPRI_MAX, which only ever raises the masking level, so critical sections
+ *              can be nested and entered from interrupt handlers.
+ *
+ * @param       priority  The most urgent priority to mask. (1 - 15, 0 cannot be masked this way)
+ *
+ * @return      The previous BASEPRI value, to be passed to criticalExit().
+ *
+ * @ingroup     atomic_func
+ */
+static inline uint32_t criticalEnter(uint8_t priority) {
+  uint32_t basepri;
+
+  asm volatile("mrs %0, basepri" : "=r" (basepri) : : "memory");
+  asm volatile("msr basepri_max, %0" : : "r" ((uint32_t)priority << 4) : "memory");
+  return basepri;
+}
+
+
+/***************************************************************************************************
+ * @brief       Restores the BASEPRI value returned by criticalEnter().
+ *
+ * @ingroup     atomic_func
+ */
+static inline void criticalExit(uint32_t basepri) {
+  asm volatile("msr basepri, %0" : : "r" (basepri) : "memory");
+}
+
+
+/***************************************************************************************************
+ * @brief       Masks every interrupt through PRIMASK.
+ *
+ * @details     Only needed to sleep with WFI right after checking for pending work: unlike
+ *              BASEPRI, PRIMASK does not prevent a pending interrupt from waking the core up.
+ *
+ * @return      The previous PRIMASK value, to be passed to criticalExitAll().
+ *
+ * @ingroup     atomic_func
+ */
+static inline uint32_t criticalEnterAll(void) {
+  uint32_t primask;
+
+  asm volatile("mrs %0, primask\n"
+               "cpsid i\n"
+               : "=r" (primask) : : "memory");
+  return primask;
+}
+
+
+/***************************************************************************************************
+ * @brief       Restores the PRIMASK value returned by criticalEnterAll().
+ *
+ * @ingroup     atomic_func
+ */
+static inline void criticalExitAll(uint32_t primask) {
+  asm volatile("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+
+#endif
@@ -0,0 +1,87 @@
+/***************************************************************************************************
+ * @file        bitband.h
+ * @defgroup    bitband bitband.h
+ *
+ * @brief       Header file for the Cortex-M4 bit-band regions.
+ *
+ * @details     This file provides macros to access single bits of the peripheral registers and of
+ *              SRAM through their bit-band alias. Each bit of the first megabyte of the peripheral
+ *              and SRAM regions is mapped to a word of the alias region: writing 0 or 1 to that
+ *              word clears or sets only that bit, and reading it returns the bit.
+ *
+ *              A write to the alias is a single store that the bus matrix turns into a locked
+ *              read-modify-write, so no interrupt can run in between and change another bit of the
+ *              same register. Setting or clearing one bit of a register shared with an interrupt
+ *              handler needs no critical section this way.
+ *
+ *              When the register and the bit are constants the alias address is folded by the
+ *              compiler, e.g. BITBAND_PERIPH(RCC->AHB1ENR, 0) = 1.
+ *
+ * @note        Only single bits can be changed atomically this way. Fields of several bits still
+ *              need a critical section (see atomic.h). Registers with bits that are cleared by
+ *              writing 1 (e.g. EXTI->PR) must not be accessed through the alias: the locked
+ *              read-modify-write would write back every pending flag.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef BITBAND_H
+#define BITBAND_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    bitband_def Bit-Band Definitions
+ * @ingroup     bitband
+ * @{
+ */
+#define BITBAND_PERIPH_BASE   (0x40000000UL)    /**< Start of the peripheral bit-band region */
+#define BITBAND_PERIPH_ALIAS  (0x42000000UL)    /**< Start of the peripheral alias region */
+#define BITBAND_SRAM_BASE     (0x20000000UL)    /**< Start of the SRAM bit-band region */
+#define BITBAND_SRAM_ALIAS    (0x22000000UL)    /**< Start of the SRAM alias region */
+/** @} */
+
+
+/**
+ * @defgroup    bitband_macro Bit-Band Macros
+ * @ingroup     bitband
+ * @{
+ */
+
+/** Alias word of bit "bit" of the word at "addr", given the bases of its region */
+#define BITBAND_ALIAS(base, alias, addr, bit) \
+  (*(volatile uint32_t *)((alias) + (((uint32_t)(addr) - (base)) << 5) + ((uint32_t)(bit) << 2)))
+
+/** Alias word of bit "bit" of a peripheral register, "reg" being the register itself */
+#define BITBAND_PERIPH(reg, bit) \
+  BITBAND_ALIAS(BITBAND_PERIPH_BASE, BITBAND_PERIPH_ALIAS, &(reg), (bit))
+
+/** Alias word of bit "bit" of a 32-bit variable in SRAM, "var" being the variable itself */
+#define BITBAND_SRAM(var, bit) \
+  BITBAND_ALIAS(BITBAND_SRAM_BASE, BITBAND_SRAM_ALIAS, &(var), (bit))
+
+/** @} */
+
+
+#endif
@@ -0,0 +1,159 @@
+/***************************************************************************************************
+ * @file        clk.h
+ * @defgroup    clk clk.h
+ *
+ * @brief       Header file for the peripheral clock gating manager.
+ *
+ * @details     This file provides the definitions and functions to turn the bus clock of each
+ *              peripheral on and off on demand. Every driver or application code that uses a
+ *              peripheral takes a reference with clkEnable() and gives it back with clkRelease().
+ *              The clock is enabled when the first reference is taken and gated off when the
+ *              last one is released, so a peripheral that nobody uses draws no dynamic power.
+ *
+ *              In Sleep mode a peripheral keeps its clock only if both its enable bit and its low
+ *              power enable bit (RCC AHB1LPENR, APB1LPENR, APB2LPENR) are set. All the low power
+ *              enable bits are set after reset; clkSetSleep() clears the ones of peripherals that
+ *              have nothing to do while the core sleeps.
+ *
+ * @note        Registers keep their value while the clock of a peripheral is off, but they cannot
+ *              be written. Code that sets enable bits directly in RCC is not counted, and its clock
+ *              is gated off when the last clkRelease() of that peripheral is called.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef CLK_H
+#define CLK_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    clk_def Clock Definitions
+ * @ingroup     clk
+ * @{
+ */
+#define CLK_AHB1            (0U << 5)             /**< Peripheral on AHB1 */
+#define CLK_APB1            (1U << 5)             /**< Peripheral on APB1 */
+#define CLK_APB2            (2U << 5)             /**< Peripheral on APB2 */
+#define CLK_BUSES           (3U)
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Peripherals with a gated clock. The value is the bus times 32 plus the position of
+ *              the bit in the enable registers of that bus.
+ *
+ * @ingroup     clk
+ */
+typedef enum {
+  kClkGpioA = CLK_AHB1 | 0,
+  kClkGpioB = CLK_AHB1 | 1,
+  kClkGpioC = CLK_AHB1 | 2,
+  kClkGpioH = CLK_AHB1 | 7,
+  kClkCrc = CLK_AHB1 | 12,
+  kClkDma1 = CLK_AHB1 | 21,
+  kClkDma2 = CLK_AHB1 | 22,
+  kClkRng = CLK_AHB1 | 31,
+  kClkTim5 = CLK_APB1 | 3,
+  kClkTim6 = CLK_APB1 | 4,
+  kClkLptim1 = CLK_APB1 | 9,
+  kClkRtcApb = CLK_APB1 | 10,
+  kClkWwdg = CLK_APB1 | 11,
+  kClkSpi2 = CLK_APB1 | 14,
+  kClkUsart2 = CLK_APB1 | 17,
+  kClkI2c1 = CLK_APB1 | 21,
+  kClkI2c2 = CLK_APB1 | 22,
+  kClkI2c4 = CLK_APB1 | 24,
+  kClkPwr = CLK_APB1 | 28,
+  kClkDac = CLK_APB1 | 29,
+  kClkTim1 = CLK_APB2 | 0,
+  kClkUsart1 = CLK_APB2 | 4,
+  kClkUsart6 = CLK_APB2 | 5,
+  kClkAdc1 = CLK_APB2 | 8,
+  kClkSpi1 = CLK_APB2 | 12,
+  kClkSyscfg = CLK_APB2 | 14,
+  kClkExti = CLK_APB2 | 15,
+  kClkTim9 = CLK_APB2 | 16,
+  kClkTim11 = CLK_APB2 | 18,
+  kClkSpi5 = CLK_APB2 | 20
+} ClkPeripheral;
+
+
+/**
+ * @defgroup    clk_func Clock Functions
+ * @ingroup     clk
+ */
+
+
+/***************************************************************************************************
+ * @brief       Takes a reference on the clock of a peripheral, enabling it if it was the first one.
+ *              When the function returns the registers of the peripheral can be accessed.
+ *
+ * @param       peripheral  The peripheral.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     clk_func
+ */
+int clkEnable(ClkPeripheral peripheral);
+
+
+/***************************************************************************************************
+ * @brief       Gives back a reference taken with clkEnable(), gating the clock off if it was the
+ *              last one.
+ *
+ * @param       peripheral  The peripheral.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     clk_func
+ */
+int clkRelease(ClkPeripheral peripheral);
+
+
+/***************************************************************************************************
+ * @brief       Returns 1 if the clock of the peripheral is enabled, 0 otherwise.
+ *
+ * @details     The enable bit is read from RCC, so clocks enabled without clkEnable() (e.g. by
+ *              the debugger or older code) are reported as well.
+ *
+ * @ingroup     clk_func
+ */
+int clkEnabled(ClkPeripheral peripheral);
+
+
+/***************************************************************************************************
+ * @brief       Chooses whether the clock of a peripheral keeps running in Sleep mode.
+ *
+ * @param       peripheral  The peripheral.
+ * @param       enabled     1 to keep the clock running in Sleep mode (reset value), 0 to gate it.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     clk_func
+ */
+int clkSetSleep(ClkPeripheral peripheral, uint8_t enabled);
+
+
+#endif
@@ -0,0 +1,122 @@
+/***************************************************************************************************
+ * @file        dwt.h
+ * @defgroup    dwt dwt.h
+ *
+ * @brief       Header file for the DWT cycle counter.
+ *
+ * @details     This file provides the functions to measure code in core clock cycles with the
+ *              cycle counter of the Data Watchpoint and Trace unit, shared by the trace buffer, the
+ *              low power statistics and the benchmarks:
+ *
+ *                  uint32_t start = dwtCycles();
+ *                  // Code to measure
+ *                  dwtStatsAdd(&stats, dwtCycles() - start);
+ *
+ *              The counter is 32 bits wide and is never reset, so differences are correct across
+ *              a wrap as long as they are shorter than 2^32 cycles (42 s at 100 MHz). It only
+ *              counts while the core clock runs: it stops in Sleep and Stop modes.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef DWT_H
+#define DWT_H
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+
+
+/***************************************************************************************************
+ * @brief       Statistics of a series of measurements.
+ *
+ * @ingroup     dwt
+ */
+typedef struct {
+  uint32_t samples;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;       /**< total / samples = average */
+} DwtStats;
+
+
+/**
+ * @defgroup    dwt_def DWT Definitions
+ * @ingroup     dwt
+ * @{
+ */
+#define DWT_STATS_INIT      { 0, UINT32_MAX, 0, 0 }   /**< Initializer of an empty DwtStats */
+/** @} */
+
+
+/**
+ * @defgroup    dwt_func DWT Functions
+ * @ingroup     dwt
+ */
+
+
+/***************************************************************************************************
+ * @brief       Powers the DWT unit and starts the cycle counter if it is not running yet.
+ *
+ * @ingroup     dwt_func
+ */
+void dwtInit(void);
+
+
+/***************************************************************************************************
+ * @brief       Returns the cycle counter.
+ *
+ * @ingroup     dwt_func
+ */
+static inline uint32_t dwtCycles(void) { return DWT->CYCCNT; }
+
+
+/***************************************************************************************************
+ * @brief       Empties a series of measurements.
+ *
+ * @param       stats     The statistics to clear.
+ *
+ * @ingroup     dwt_func
+ */
+void dwtStatsReset(volatile DwtStats *stats);
+
+
+/***************************************************************************************************
+ * @brief       Adds a measurement to a series.
+ *
+ * @param       stats     The statistics of the series.
+ * @param       cycles    The measurement.
+ *
+ * @ingroup     dwt_func
+ */
+void dwtStatsAdd(volatile DwtStats *stats, uint32_t cycles);
+
+
+/***************************************************************************************************
+ * @brief       Returns the average of a series, 0 if it is empty.
+ *
+ * @ingroup     dwt_func
+ */
+uint32_t dwtStatsAverage(const volatile DwtStats *stats);
+
+
+#endif
@@ -202,4 +202,17 @@ int gpioPinToggle(GPIO_Type *port, uint8_t pin, uint8_t *old_value);
 int gpioInterruptSet(GPIO_Type *port, uint8_t pin, uint8_t rising_edge, uint8_t priority, void (*handler)(void));
 
 
+/***************************************************************************************************
+ * @brief       Gives back the reference on the clock of a GPIO port taken by gpioPinSetup(). The
+ *              clock is gated off unless other code holds a reference on it.
+ *
+ * @param       port Pointer to the GPIO port. (Use GPIOx definitios from stm32f410rb.h)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     gpio_func
+ */
+int gpioPortRelease(GPIO_Type *port);
+
+
 #endif
\ No newline at end of file
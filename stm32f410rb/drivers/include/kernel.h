@@ -0,0 +1,146 @@
+/***************************************************************************************************
+ * @file        kernel.h
+ * @defgroup    kernel kernel.h
+ *
+ * @brief       Header file for the preemptive kernel.
+ *
+ * @details     This file provides the definitions and functions for a minimal preemptive kernel.
+ *              Every thread gets its own stack, carved from a static pool in SRAM, and runs on the
+ *              process stack (PSP) while interrupt handlers keep using the main stack (MSP).
+ *
+ *              The highest priority ready thread always runs. Threads sharing a priority level
+ *              are rotated every SysTick tick (the time slice) or when one of them yields. An idle
+ *              thread with the lowest priority sleeps in lpmIdle() when no other thread is ready;
+ *              the tick keeps a Stop mode lock, so this is always Sleep mode.
+ *
+ *              Context switches are done in the PendSV handler, which has the lowest exception
+ *              priority so it only runs once every other handler has returned. When the code is
+ *              built for the hardware FPU, the high FPU registers (S16-S31) are only saved for
+ *              threads that have used the FPU, and the hardware lazy stacking defers saving
+ *              S0-S15 until another context actually touches the FPU.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef KERNEL_H
+#define KERNEL_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    kernel_def Kernel Definitions
+ * @ingroup     kernel
+ * @{
+ */
+#define KERNEL_MAX_THREADS      (8U)        /**< Maximum number of threads, idle thread included */
+#define KERNEL_STACK_POOL_SIZE  (8192U)     /**< Bytes of SRAM shared by all the thread stacks */
+#define KERNEL_IDLE_STACK_SIZE  (256U)      /**< Bytes of stack of the idle thread */
+#define KERNEL_PRIORITIES       (16U)       /**< Thread priority levels (0 is max priority) */
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Thread entry function. Returning from it terminates the thread.
+ *
+ * @ingroup     kernel
+ */
+typedef void (*KernelThread)(void *arg);
+
+
+/**
+ * @defgroup    kernel_func Kernel Functions
+ * @ingroup     kernel
+ */
+
+
+/***************************************************************************************************
+ * @brief       Creates a thread. Can be called before or after kernelStart().
+ *
+ * @param       entry       Pointer to the function run by the thread.
+ * @param       arg         Argument passed to the function.
+ * @param       priority    The priority of the thread. (0 - KERNEL_PRIORITIES - 1, 0 is max
+ *                          priority)
+ * @param       stack_size  Bytes of stack of the thread, rounded up to a multiple of 8. Must hold
+ *                          the deepest call chain of the thread plus 68 bytes for the saved
+ *                          context (204 if the thread uses the FPU).
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     kernel_func
+ */
+int kernelThreadCreate(KernelThread entry, void *arg, uint8_t priority, uint32_t stack_size);
+
+
+/***************************************************************************************************
+ * @brief       Starts the SysTick time slice and switches to the highest priority thread.
+ *
+ * @details     The function only returns if the parameters are wrong. Otherwise the code that
+ *              called it is abandoned and its stack remains in use by the interrupt handlers.
+ *
+ * @param       core_clk_hz   Frequency of the core clock in Hz.
+ * @param       tick_hz       Frequency of the SysTick tick in Hz, which is also the time slice.
+ *
+ * @return      1 and sets variables errnum and errcode if the tick rate cannot be generated.
+ *
+ * @ingroup     kernel_func
+ */
+int kernelStart(uint32_t core_clk_hz, uint32_t tick_hz);
+
+
+/***************************************************************************************************
+ * @brief       Gives the CPU to the next ready thread with the same priority, if any.
+ *
+ * @ingroup     kernel_func
+ */
+void kernelYield(void);
+
+
+/***************************************************************************************************
+ * @brief       Blocks the calling thread for a number of ticks.
+ *
+ * @param       ticks   Number of SysTick ticks to sleep. 0 behaves like kernelYield().
+ *
+ * @ingroup     kernel_func
+ */
+void kernelSleep(uint32_t ticks);
+
+
+/***************************************************************************************************
+ * @brief       Returns the number of SysTick ticks since kernelStart().
+ *
+ * @ingroup     kernel_func
+ */
+uint32_t kernelTicks(void);
+
+
+/***************************************************************************************************
+ * @brief       Called from the SysTick handler on every tick. Weak, the application may override
+ *              it. It must not block.
+ *
+ * @ingroup     kernel_func
+ */
+void kernelTickHook(void);
+
+
+#endif
@@ -0,0 +1,169 @@
+/***************************************************************************************************
+ * @file        log.h
+ * @defgroup    log log.h
+ *
+ * @brief       Header file for the tokenized deferred logger.
+ *
+ * @details     This file provides the definitions and macros for logging messages without formatting
+ *              them on the microcontroller. The format string of every LOGx() call is placed in the
+ *              ".logfmt" section, which the linker script keeps in the ELF file but does not load
+ *              into FLASH. The offset of the string in that section is its token.
+ *
+ *              A log call only copies the token and the raw 32-bit arguments into a RAM ring, which
+ *              takes a few tens of cycles. The USART transmit interrupt drains the ring in the
+ *              background and the host tool in tools/logdec re-inflates the messages using the
+ *              strings stored in build/final.elf.
+ *
+ *              Messages can be logged from interrupt handlers with a priority value of
+ *              CRITICAL_DRIVER_PRIORITY or higher (see atomic.h).
+ *
+ *              Every message is sent as little-endian 32-bit words: a header word
+ *              (0xA0 | nargs) << 24 | token followed by nargs argument words.
+ *
+ * @note        Arguments are sent by value, so "%s" cannot be used. Floats must be passed through
+ *              logFloat() so that their bit pattern is sent.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LOG_H
+#define LOG_H
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+
+
+/**
+ * @defgroup    log_def Logger Definitions
+ * @ingroup     log
+ * @{
+ */
+#define LOG_RING_WORDS      (256U)            /**< Ring size in words, must be a power of two */
+#define LOG_MAX_ARGS        (4U)              /**< Maximum number of arguments of a message */
+/** @} */
+
+
+/**
+ * @defgroup    log_macros Logging Macros
+ * @ingroup     log
+ *
+ * @details     Each macro defines a static copy of the format string in the ".logfmt" section and
+ *              logs its address (the token) together with the arguments.
+ * @{
+ */
+#define LOG_TOKEN(fmt)                                                                             \
+  __extension__ ({                                                                                 \
+    static const char log_fmt[] __attribute__((section(".logfmt"), used)) = fmt;                   \
+    (uint32_t)log_fmt;                                                                             \
+  })
+
+#define LOG0(fmt)                                                                                  \
+  logWrite(LOG_TOKEN(fmt), 0, 0, 0, 0, 0)
+#define LOG1(fmt, a)                                                                               \
+  logWrite(LOG_TOKEN(fmt), 1, (uint32_t)(a), 0, 0, 0)
+#define LOG2(fmt, a, b)                                                                            \
+  logWrite(LOG_TOKEN(fmt), 2, (uint32_t)(a), (uint32_t)(b), 0, 0)
+#define LOG3(fmt, a, b, c)                                                                         \
+  logWrite(LOG_TOKEN(fmt), 3, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), 0)
+#define LOG4(fmt, a, b, c, d)                                                                      \
+  logWrite(LOG_TOKEN(fmt), 4, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d))
+/** @} */
+
+
+/**
+ * @defgroup    log_func Logger Functions
+ * @ingroup     log
+ */
+
+
+/***************************************************************************************************
+ * @brief       Attaches the logger to a USART.
+ *
+ * @details     The USART must already be configured and have its transmitter enabled.
+ *              The application must call logUsartIsr() from the interrupt handler of that USART.
+ *
+ * @param       usart     The USART used to drain the ring. (USART1, USART2 or USART6)
+ * @param       priority  The interrupt priority level (between CRITICAL_DRIVER_PRIORITY and 15).
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     log_func
+ */
+int logInit(USART_Type *usart, uint8_t priority);
+
+
+/***************************************************************************************************
+ * @brief       Queues one message. Use the LOGx() macros instead of calling this directly.
+ *
+ * @details     If the ring does not have room for the whole message it is dropped and counted in
+ *              log_dropped.
+ *
+ * @param       token   Offset of the format string in the ".logfmt" section.
+ * @param       nargs   Number of valid arguments. (0 - LOG_MAX_ARGS)
+ * @param       a0..a3  Raw arguments.
+ *
+ * @ingroup     log_func
+ */
+void logWrite(uint32_t token, uint32_t nargs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+
+
+/***************************************************************************************************
+ * @brief       Sends the next byte of the ring. Must be called from the USARTx_ISR of the USART
+ *              passed to logInit().
+ *
+ * @details     Stop mode is locked (see lpm.h) from the first logWrite() until the ring is empty
+ *              and the last byte has left the USART.
+ *
+ * @ingroup     log_func
+ */
+void logUsartIsr(void);
+
+
+/***************************************************************************************************
+ * @brief       Blocks until every queued message has been sent.
+ *
+ * @ingroup     log_func
+ */
+void logFlush(void);
+
+
+/***************************************************************************************************
+ * @brief       Number of messages dropped because the ring was full.
+ *
+ * @ingroup     log
+ */
+extern volatile uint32_t log_dropped;
+
+
+/***************************************************************************************************
+ * @brief       Returns the bit pattern of a float so it can be logged and printed with "%f".
+ *
+ * @ingroup     log_func
+ */
+static inline uint32_t logFloat(float value) {
+  union { float f; uint32_t u; } bits = { .f = value };
+  return bits.u;
+}
+
+
+#endif
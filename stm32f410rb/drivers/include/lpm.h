@@ -0,0 +1,190 @@
+/***************************************************************************************************
+ * @file        lpm.h
+ * @defgroup    lpm lpm.h
+ *
+ * @brief       Header file for the low power idle framework.
+ *
+ * @details     This file provides the definitions and functions to put the microcontroller in a
+ *              low power state while there is nothing to do:
+ *
+ *              - Sleep: the core clock stops, peripherals keep running (see clkSetSleep()) and any
+ *                enabled interrupt wakes the core up within a few cycles.
+ *
+ *              - Stop: all the clocks of the 1.2 V domain stop, the regulator and the flash go to
+ *                low power mode, and only EXTI lines (GPIO, RTC, LPTIM1...) wake the core up. The
+ *                system clock is HSI after waking up; lpmIdle() restores HSE and the PLL before
+ *                returning, so the rest of the code never sees the change.
+ *
+ *              The main loop checks for work with every interrupt masked and calls lpmIdle() when
+ *              there is none, which picks Stop unless a driver that needs its clocks has called
+ *              lpmStopLock(). The drivers whose clocks stop in Stop mode (log, adc, prof, swtimer
+ *              and the kernel tick) hold a lock while they are active, and sched and the kernel
+ *              idle thread sleep through lpmIdle():
+ *
+ *                  while (1) {
+ *                    uint32_t primask = criticalEnterAll();
+ *                    if (!work_pending) lpmIdle();
+ *                    criticalExitAll(primask);
+ *                    // Do the work
+ *                  }
+ *
+ *              Applications that only work inside interrupt handlers call lpmSleepOnExit() at
+ *              the end of main() instead: the core goes back to sleep each time the last handler
+ *              returns, without running any thread mode code.
+ *
+ *              The time spent in each state is measured with a clock given to lpmInit(), which has
+ *              to keep counting in every state entered (e.g. the RTC or LPTIM1 for Stop mode;
+ *              DWT->CYCCNT is not suitable since it stops with the core clock). After
+ *              lpmSleepOnExit(), the run time is taken from DWT->CYCCNT and the rest is counted as
+ *              sleeping when lpmGetStats() is called.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LPM_H
+#define LPM_H
+
+
+#include <stdint.h>
+
+
+/***************************************************************************************************
+ * @brief       Power states.
+ *
+ * @ingroup     lpm
+ */
+typedef enum {
+  kLpmRun = 0,
+  kLpmSleep,
+  kLpmStop,
+  kLpmStates
+} LpmState;
+
+
+/***************************************************************************************************
+ * @brief       Free-running clock used to measure the time spent in each state. Only differences
+ *              between two readings are used, so it may wrap around.
+ *
+ * @ingroup     lpm
+ */
+typedef uint32_t (*LpmClock)(void);
+
+
+/***************************************************************************************************
+ * @brief       Statistics of the power states, indexed by LpmState. Times are in units of the clock
+ *              given to lpmInit() and cover the time since lpmInit().
+ *
+ * @ingroup     lpm
+ */
+typedef struct {
+  uint32_t time[kLpmStates];
+  uint32_t entries[kLpmStates];
+} LpmStats;
+
+
+/**
+ * @defgroup    lpm_func Low Power Functions
+ * @ingroup     lpm
+ */
+
+
+/***************************************************************************************************
+ * @brief       Enables the PWR clock, selects the low power regulator and flash power-down for
+ *              Stop mode and clears the statistics.
+ *
+ * @param       clock     Clock used to measure the time in each state, NULL to only count entries.
+ * @param       clock_hz  Frequency of the clock, only used to convert the cycles of the core after
+ *                        lpmSleepOnExit().
+ *
+ * @ingroup     lpm_func
+ */
+void lpmInit(LpmClock clock, uint32_t clock_hz);
+
+
+/***************************************************************************************************
+ * @brief       Sleeps until an interrupt is pending, in Stop mode if no lock is held and in Sleep
+ *              mode otherwise.
+ *
+ * @details     Must be called with PRIMASK set (criticalEnterAll()), right after checking that
+ *              there is no work left. A pending interrupt still wakes the core up, and its handler
+ *              runs once the caller restores PRIMASK, after the clocks have been restored.
+ *
+ * @ingroup     lpm_func
+ */
+void lpmIdle(void);
+
+
+/***************************************************************************************************
+ * @brief       Sleeps forever, waking up only to run interrupt handlers. Must be called at the end
+ *              of main() with interrupts enabled.
+ *
+ * @details     The system clock must be the one reported by perfHclkHz(). lpmGetStats() has to be
+ *              called, from a handler, at least once per wrap of the statistics clock and of
+ *              DWT->CYCCNT.
+ *
+ * @param       state     kLpmSleep, or kLpmStop if the system clock is HSI (interrupt handlers run
+ *                        right after waking up, before any clock could be restored).
+ *
+ * @return      Only returns, with 1, on error. Sets variables errnum and errcode.
+ *
+ * @ingroup     lpm_func
+ */
+int lpmSleepOnExit(LpmState state);
+
+
+/***************************************************************************************************
+ * @brief       Prevents Stop mode, e.g. while a transfer that needs the peripheral clocks is
+ *              running. Locks are counted and can be taken from interrupt handlers.
+ *
+ * @details     lpmIdle() enters Sleep mode instead while a lock is held. After
+ *              lpmSleepOnExit(kLpmStop), the first lock clears SLEEPDEEP, so the core only sleeps
+ *              when the handler that took it returns.
+ *
+ * @ingroup     lpm_func
+ */
+void lpmStopLock(void);
+
+
+/***************************************************************************************************
+ * @brief       Releases a lock taken with lpmStopLock().
+ *
+ * @details     After lpmSleepOnExit(kLpmStop), releasing the last lock sets SLEEPDEEP again.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     lpm_func
+ */
+int lpmStopUnlock(void);
+
+
+/***************************************************************************************************
+ * @brief       Copies the statistics of the power states, first splitting the time since the last
+ *              call between run and sleep if lpmSleepOnExit() was called.
+ *
+ * @param       stats     Where the statistics are stored.
+ *
+ * @ingroup     lpm_func
+ */
+void lpmGetStats(LpmStats *stats);
+
+
+#endif
@@ -0,0 +1,103 @@
+/***************************************************************************************************
+ * @file        mem.h
+ * @defgroup    mem mem.h
+ *
+ * @brief       Header file for the memory block routines.
+ *
+ * @details     This file provides memcpy(), memset() and memmove() for programs linked without a C
+ *              library. Besides explicit calls, GCC emits calls to them on its own for structure
+ *              assignments and initializations of large local arrays, so every program that links
+ *              the driver library gets them.
+ *
+ *              The routines are written in assembly for the Cortex-M4 so that their speed does not
+ *              depend on the optimization level:
+ *
+ *              - Blocks under 16 bytes are copied byte by byte, skipping all the setup.
+ *              - Otherwise the destination is first aligned to a word boundary. If the source ends
+ *                up aligned too, 32 bytes are moved per LDM/STM pair; if not, words are moved with
+ *                unaligned LDR and aligned STR (LDM does not support unaligned addresses).
+ *              - The last 0-3 bytes are moved one at a time.
+ *
+ * @note        Unaligned LDR must not be trapped (UNALIGN_TRP clear in SCB->CCR, the reset value).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MEM_H
+#define MEM_H
+
+
+#include <stddef.h>
+
+
+/**
+ * @defgroup    mem_func Memory Functions
+ * @ingroup     mem
+ */
+
+
+/***************************************************************************************************
+ * @brief       Copies n bytes from src to dst. The blocks must not overlap.
+ *
+ * @param       dst       Destination.
+ * @param       src       Source.
+ * @param       n         Number of bytes.
+ *
+ * @return      dst.
+ *
+ * @ingroup     mem_func
+ */
+void *memcpy(void *restrict dst, const void *restrict src, size_t n);
+
+
+/***************************************************************************************************
+ * @brief       Sets n bytes of dst to the value c (converted to uint8_t).
+ *
+ * @param       dst       Destination.
+ * @param       c         Value.
+ * @param       n         Number of bytes.
+ *
+ * @return      dst.
+ *
+ * @ingroup     mem_func
+ */
+void *memset(void *dst, int c, size_t n);
+
+
+/***************************************************************************************************
+ * @brief       Copies n bytes from src to dst. The blocks may overlap.
+ *
+ * @details     Copies forward with memcpy() when dst is below src or the blocks do not overlap,
+ *              and backward otherwise.
+ *
+ * @param       dst       Destination.
+ * @param       src       Source.
+ * @param       n         Number of bytes.
+ *
+ * @return      dst.
+ *
+ * @ingroup     mem_func
+ */
+void *memmove(void *dst, const void *src, size_t n);
+
+
+#endif
@@ -0,0 +1,238 @@
+/***************************************************************************************************
+ * @file        nvic.h
+ * @defgroup    nvic nvic.h
+ *
+ * @brief       Header file for the NVIC driver.
+ *
+ * @details     This file provides the interrupt numbers of the STM32F410RB, in the order of the
+ *              vector table in startup.c, and the functions to enable, disable, pend and
+ *              prioritize them.
+ *
+ *              The enable and pending state is changed through the set and clear registers (ISER,
+ *              ICER, ISPR, ICPR), where writing a 1 acts on one interrupt and writing a 0 does
+ *              nothing, so no read-modify-write is needed and no critical section either.
+ *
+ *              The 4 priority bits of the STM32F410RB are split between preemption priority and
+ *              sub-priority with nvicSetPriorityGrouping(). Only the preemption priority decides
+ *              whether an interrupt can interrupt another one; the sub-priority only orders
+ *              pending interrupts. nvicSetPriority() takes the raw 4-bit value, which can be built
+ *              from both parts with nvicEncodePriority().
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NVIC_H
+#define NVIC_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    nvic_def NVIC Definitions
+ * @ingroup     nvic
+ * @{
+ */
+#define NVIC_PRIORITY_BITS  (4U)                          /**< Implemented priority bits */
+#define NVIC_IRQ_COUNT      (99U)                         /**< Interrupts in the vector table */
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Interrupt numbers.
+ *
+ * @details     Negative numbers are the system exceptions with a configurable priority. Numbers
+ *              that are missing are reserved entries of the vector table.
+ *
+ * @ingroup     nvic
+ */
+typedef enum {
+  kIrqMemManage = -12,
+  kIrqBusFault = -11,
+  kIrqUsageFault = -10,
+  kIrqSVCall = -5,
+  kIrqDebugMonitor = -4,
+  kIrqPendSV = -2,
+  kIrqSysTick = -1,
+  kIrqWwdg = 0,
+  kIrqPvd = 1,
+  kIrqExti21TampStamp = 2,
+  kIrqExti22RtcWkup = 3,
+  kIrqFlash = 4,
+  kIrqRcc = 5,
+  kIrqExti0 = 6,
+  kIrqExti1 = 7,
+  kIrqExti2 = 8,
+  kIrqExti3 = 9,
+  kIrqExti4 = 10,
+  kIrqDma1Stream0 = 11,
+  kIrqDma1Stream1 = 12,
+  kIrqDma1Stream2 = 13,
+  kIrqDma1Stream3 = 14,
+  kIrqDma1Stream4 = 15,
+  kIrqDma1Stream5 = 16,
+  kIrqDma1Stream6 = 17,
+  kIrqAdc = 18,
+  kIrqExti9_5 = 23,
+  kIrqTim1BrkTim9 = 24,
+  kIrqTim1Up = 25,
+  kIrqTim1TrgComTim11 = 26,
+  kIrqTim1Cc = 27,
+  kIrqI2c1Ev = 31,
+  kIrqI2c1Er = 32,
+  kIrqI2c2Ev = 33,
+  kIrqI2c2Er = 34,
+  kIrqSpi1 = 35,
+  kIrqSpi2 = 36,
+  kIrqUsart1 = 37,
+  kIrqUsart2 = 38,
+  kIrqExti15_10 = 40,
+  kIrqExti17RtcAlarm = 41,
+  kIrqDma1Stream7 = 47,
+  kIrqTim5 = 50,
+  kIrqTim6Dac = 54,
+  kIrqDma2Stream0 = 56,
+  kIrqDma2Stream1 = 57,
+  kIrqDma2Stream2 = 58,
+  kIrqDma2Stream3 = 59,
+  kIrqDma2Stream4 = 60,
+  kIrqExti19 = 62,
+  kIrqDma2Stream5 = 68,
+  kIrqDma2Stream6 = 69,
+  kIrqDma2Stream7 = 70,
+  kIrqUsart6 = 71,
+  kIrqExti20 = 76,
+  kIrqRng = 80,
+  kIrqFpu = 81,
+  kIrqSpi5 = 85,
+  kIrqI2c4Ev = 96,
+  kIrqI2c4Er = 97,
+  kIrqExti23Lptim1 = 98
+} NvicIrq;
+
+
+/**
+ * @defgroup    nvic_func NVIC Functions
+ * @ingroup     nvic
+ */
+
+
+/***************************************************************************************************
+ * @brief       Enables an interrupt.
+ *
+ * @param       irq       The interrupt. (0 - NVIC_IRQ_COUNT - 1)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     nvic_func
+ */
+int nvicEnable(NvicIrq irq);
+
+
+/***************************************************************************************************
+ * @brief       Disables an interrupt. When the function returns the interrupt handler can no
+ *              longer be entered.
+ *
+ * @param       irq       The interrupt. (0 - NVIC_IRQ_COUNT - 1)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     nvic_func
+ */
+int nvicDisable(NvicIrq irq);
+
+
+/***************************************************************************************************
+ * @brief       Sets the pending state of an interrupt, which runs its handler once it is enabled
+ *              and its priority allows it.
+ *
+ * @param       irq       The interrupt. (0 - NVIC_IRQ_COUNT - 1)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     nvic_func
+ */
+int nvicSetPending(NvicIrq irq);
+
+
+/***************************************************************************************************
+ * @brief       Clears the pending state of an interrupt.
+ *
+ * @param       irq       The interrupt. (0 - NVIC_IRQ_COUNT - 1)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     nvic_func
+ */
+int nvicClearPending(NvicIrq irq);
+
+
+/***************************************************************************************************
+ * @brief       Sets the priority of an interrupt or of a system exception.
+ *
+ * @param       irq       The interrupt or system exception.
+ * @param       priority  The raw priority level, 0 is the most urgent. (0 - 15)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     nvic_func
+ */
+int nvicSetPriority(NvicIrq irq, uint8_t priority);
+
+
+/***************************************************************************************************
+ * @brief       Sets how many of the priority bits are preemption priority, the rest being
+ *              sub-priority. The reset value is 4 (no sub-priority).
+ *
+ * @param       preempt_bits  Bits of preemption priority. (0 - 4)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     nvic_func
+ */
+int nvicSetPriorityGrouping(uint8_t preempt_bits);
+
+
+/***************************************************************************************************
+ * @brief       Returns the bits of preemption priority set by nvicSetPriorityGrouping().
+ *
+ * @ingroup     nvic_func
+ */
+uint8_t nvicGetPriorityGrouping(void);
+
+
+/***************************************************************************************************
+ * @brief       Builds a raw priority level from a preemption priority and a sub-priority,
+ *              according to the current priority grouping. Values too large for their field are
+ *              truncated.
+ *
+ * @param       preempt   The preemption priority. (0 - 2^preempt_bits - 1)
+ * @param       sub       The sub-priority. (0 - 2^(4 - preempt_bits) - 1)
+ *
+ * @return      The raw priority level, to be passed to nvicSetPriority().
+ *
+ * @ingroup     nvic_func
+ */
+uint8_t nvicEncodePriority(uint8_t preempt, uint8_t sub);
+
+
+#endif
@@ -0,0 +1,112 @@
+/***************************************************************************************************
+ * @file        perf.h
+ * @defgroup    perf perf.h
+ *
+ * @brief       Header file for the performance profiles.
+ *
+ * @details     This file provides the definitions and functions to switch the system clock between
+ *              a few named profiles. Each profile sets, consistently and in a safe order, the
+ *              system clock source, the bus prescalers, the regulator voltage scale, the flash wait
+ *              states and the ART accelerator (prefetch, instruction cache and data cache):
+ *
+ *              | Profile        | SYSCLK  | Source        | Scale | Wait states | Prefetch | Caches |
+ *              |----------------|---------|---------------|-------|-------------|----------|--------|
+ *              | kPerfMax       | 100 MHz | PLL from HSI  | 1     | 3           | On       | On     |
+ *              | kPerfBalanced  | 64 MHz  | PLL from HSI  | 3     | 1           | Off      | On     |
+ *              | kPerfLowPower  | 16 MHz  | HSI           | 3     | 0           | Off      | On     |
+ *
+ *              APB1 runs at half the system clock in the PLL profiles (it is limited to 50 MHz) and
+ *              APB2 at the system clock. Wait states are those of a 2.7 V - 3.6 V supply.
+ *
+ * @note        The clock frequencies change, so peripherals that depend on them (USART baud rates,
+ *              timer periods, the SysTick reload value) must be configured again, using
+ *              perfHclkHz(), perfApb1Hz() and perfApb2Hz().
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PERF_H
+#define PERF_H
+
+
+#include <stdint.h>
+
+
+/***************************************************************************************************
+ * @brief       Performance profiles.
+ *
+ * @ingroup     perf
+ */
+typedef enum {
+  kPerfMax = 0,
+  kPerfBalanced,
+  kPerfLowPower,
+  kPerfProfiles
+} PerfProfile;
+
+
+/**
+ * @defgroup    perf_func Performance Functions
+ * @ingroup     perf
+ */
+
+
+/***************************************************************************************************
+ * @brief       Switches to a performance profile.
+ *
+ * @details     The system clock runs from HSI during the switch, which takes the time the PLL
+ *              needs to lock (up to a few hundred microseconds).
+ *
+ * @param       profile   The profile.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     perf_func
+ */
+int perfSetProfile(PerfProfile profile);
+
+
+/***************************************************************************************************
+ * @brief       Returns the frequency of the core and AHB clock (HCLK) in Hz.
+ *
+ * @ingroup     perf_func
+ */
+uint32_t perfHclkHz(void);
+
+
+/***************************************************************************************************
+ * @brief       Returns the frequency of the APB1 peripheral clock in Hz.
+ *
+ * @ingroup     perf_func
+ */
+uint32_t perfApb1Hz(void);
+
+
+/***************************************************************************************************
+ * @brief       Returns the frequency of the APB2 peripheral clock in Hz.
+ *
+ * @ingroup     perf_func
+ */
+uint32_t perfApb2Hz(void);
+
+
+#endif
@@ -0,0 +1,132 @@
+/***************************************************************************************************
+ * @file        prof.h
+ * @defgroup    prof prof.h
+ *
+ * @brief       Header file for the statistical sampling profiler.
+ *
+ * @details     This file provides the definitions and functions for a sampling profiler that
+ *              periodically interrupts the program with TIM11 and reads the program counter that
+ *              the processor stacked on exception entry. Every sample is binned into a compact
+ *              histogram that covers the code in FLASH, so that the bins with the most hits show
+ *              where the CPU spends its cycles.
+ *
+ *              The histogram can be dumped through any byte sink (e.g. a USART) with profDump() or
+ *              read from memory through the debugger, and then mapped to function names with the
+ *              host tool in tools/profmap using the build/final.map file of the application.
+ *
+ * @note        TIM11 runs at the highest NVIC priority (0) so that code executing inside other
+ *              interrupt handlers is sampled as well.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PROF_H
+#define PROF_H
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+
+
+/**
+ * @defgroup    prof_def Profiler Definitions
+ * @ingroup     prof
+ * @{
+ */
+#define PROF_MAGIC          (0x464F5250UL)    /**< "PROF" in little-endian byte order */
+#define PROF_MAX_BINS       (256U)            /**< Number of histogram bins */
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Profiler histogram.
+ *
+ * @details     Bin i counts the samples whose PC fell in [base + (i << shift),
+ *              base + ((i + 1) << shift)). Counters saturate at 0xFFFF instead of wrapping.
+ *              The layout of this structure is the dump format read by tools/profmap, so fields
+ *              must not be reordered.
+ *
+ * @ingroup     prof
+ */
+typedef struct {
+  uint32_t magic;                     /**< Always PROF_MAGIC */
+  uint32_t base;                      /**< Address covered by bin 0 */
+  uint16_t shift;                     /**< log2 of the bin width in bytes */
+  uint16_t bins;                      /**< Number of bins in use */
+  uint32_t samples;                   /**< Total number of samples taken */
+  uint32_t outside;                   /**< Samples whose PC fell outside of the binned range */
+  uint16_t count[PROF_MAX_BINS];      /**< Sample counters */
+} ProfHistogram;
+
+
+/***************************************************************************************************
+ * @brief       Histogram filled by the profiler.
+ *
+ * @details     Exposed so that it can also be read through the debugger, e.g. with
+ *              `dump_image prof.bin &prof_histogram sizeof(prof_histogram)` in OpenOCD.
+ *
+ * @ingroup     prof
+ */
+extern volatile ProfHistogram prof_histogram;
+
+
+/**
+ * @defgroup    prof_func Profiler Functions
+ * @ingroup     prof
+ */
+
+
+/***************************************************************************************************
+ * @brief       Clears the histogram and starts sampling.
+ *
+ * @param       timer_clk_hz  Frequency of the clock feeding TIM11 (APB2 timer clock) in Hz.
+ * @param       sample_hz     Desired sampling rate in Hz. (1 - timer_clk_hz / 2)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     prof_func
+ */
+int profStart(uint32_t timer_clk_hz, uint32_t sample_hz);
+
+
+/***************************************************************************************************
+ * @brief       Stops sampling. The histogram is preserved.
+ *
+ * @ingroup     prof_func
+ */
+void profStop(void);
+
+
+/***************************************************************************************************
+ * @brief       Writes the histogram to a byte sink.
+ *
+ * @details     The header and the bins in use are written in the in-memory (little-endian) layout
+ *              of ProfHistogram, which is the format expected by tools/profmap.
+ *
+ * @param       put_byte  Function called once per byte, e.g. a blocking USART write.
+ *
+ * @ingroup     prof_func
+ */
+void profDump(void (*put_byte)(uint8_t byte));
+
+
+#endif
@@ -0,0 +1,109 @@
+/***************************************************************************************************
+ * @file        sched.h
+ * @defgroup    sched sched.h
+ *
+ * @brief       Header file for the cooperative run-to-completion scheduler.
+ *
+ * @details     This file provides the definitions and functions for a scheduler in which every task
+ *              is a handler function bound to a unique priority level and owning a small event
+ *              queue. Posting an event (from the main loop or from an interrupt handler) queues it
+ *              and marks the task as ready. The scheduler always dispatches the oldest event of the
+ *              highest priority ready task, and every handler runs to completion before the next
+ *              one is dispatched.
+ *
+ *              Ready tasks are tracked in a 32-bit bitmap where priority p owns bit (31 - p), so the
+ *              highest priority ready task is found with a single CLZ instruction.
+ *              When no task is ready the CPU sleeps in lpmIdle() until an interrupt posts new work,
+ *              in Stop mode unless a driver holds a lock (see lpm.h).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SCHED_H
+#define SCHED_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    sched_def Scheduler Definitions
+ * @ingroup     sched
+ * @{
+ */
+#define SCHED_MAX_TASKS     (32U)       /**< Number of priority levels (0 is max priority) */
+#define SCHED_QUEUE_SIZE    (8U)        /**< Events per task queue, must be a power of two */
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Task handler, called once per event posted to the task.
+ *
+ * @ingroup     sched
+ */
+typedef void (*SchedHandler)(uint32_t event);
+
+
+/**
+ * @defgroup    sched_func Scheduler Functions
+ * @ingroup     sched
+ */
+
+
+/***************************************************************************************************
+ * @brief       Registers a task.
+ *
+ * @param       priority  The priority of the task, which also identifies it. (0 - 31, 0 is max
+ *                        priority)
+ * @param       handler   Pointer to the function that handles the events of the task.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     sched_func
+ */
+int schedTaskCreate(uint8_t priority, SchedHandler handler);
+
+
+/***************************************************************************************************
+ * @brief       Posts an event to a task. Can be called from interrupt handlers with a priority value
+ *              of CRITICAL_DRIVER_PRIORITY or higher (see atomic.h).
+ *
+ * @param       priority  The priority of the task.
+ * @param       event     The event value passed to the handler.
+ *
+ * @return      0 if successful, 1 if the queue of the task is full (the event is dropped).
+ *              Posting to a task that does not exist sets variables errnum and errcode.
+ *
+ * @ingroup     sched_func
+ */
+int schedPost(uint8_t priority, uint32_t event);
+
+
+/***************************************************************************************************
+ * @brief       Dispatches events forever, sleeping whenever no task is ready.
+ *
+ * @ingroup     sched_func
+ */
+void schedRun(void) __attribute__((noreturn));
+
+
+#endif
@@ -10,7 +10,7 @@
  * 
  * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
  * 
- * @date        Last Updated:   01/10/2023
+ * @date        Last Updated:   18/10/2026
  * 
  * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
  * 
@@ -214,6 +214,56 @@ typedef struct {
 /** @} */
 
 
+/***************************************************************************************************
+ * @brief       SCB register structure
+ *
+ * @details     This structure represents the System Control Block register block, which contains
+ *              the exception control, system handler priority and fault status registers.
+ * 
+ * @defgroup    scb_reg SCB
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __I  uint32_t CPUID;          /**< 0x00 (R) CPUID base */
+  __IO uint32_t ICSR;           /**< 0x04 (R/W) Interrupt control and state */
+  __IO uint32_t VTOR;           /**< 0x08 (R/W) Vector table offset */
+  __IO uint32_t AIRCR;          /**< 0x0C (R/W) Application interrupt and reset control */
+  __IO uint32_t SCR;            /**< 0x10 (R/W) System control */
+  __IO uint32_t CCR;            /**< 0x14 (R/W) Configuration and control */
+  __IO uint8_t SHPR[12];        /**< 0x18-0x23 (R/W) System handler priority (exceptions 4..15) */
+  __IO uint32_t SHCSR;          /**< 0x24 (R/W) System handler control and state */
+  __IO uint32_t CFSR;           /**< 0x28 (R/W) Configurable fault status */
+  __IO uint32_t HFSR;           /**< 0x2C (R/W) HardFault status */
+  __IO uint32_t DFSR;           /**< 0x30 (R/W) Debug fault status */
+  __IO uint32_t MMFAR;          /**< 0x34 (R/W) MemManage fault address */
+  __IO uint32_t BFAR;           /**< 0x38 (R/W) BusFault address */
+  __IO uint32_t AFSR;           /**< 0x3C (R/W) Auxiliary fault status */
+  __I  uint32_t RESERVED2[18];
+  __IO uint32_t CPACR;          /**< 0x88 (R/W) Coprocessor access control */
+} SCB_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       SysTick register structure
+ *
+ * @details     This structure represents the SysTick register block, which contains the
+ *              configuration and control registers of the 24-bit system timer of the Cortex-M4.
+ * 
+ * @defgroup    systick_reg SysTick
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __IO uint32_t CTRL;           /**< 0x00 (R/W) Control and status */
+  __IO uint32_t LOAD;           /**< 0x04 (R/W) Reload value */
+  __IO uint32_t VAL;            /**< 0x08 (R/W) Current value */
+  __I  uint32_t CALIB;          /**< 0x0C (R) Calibration value */
+} SysTick_Type;
+/** @} */
+
+
 /***************************************************************************************************
  * @brief       EXTI register structure
  *
@@ -258,6 +308,213 @@ typedef struct {
 /** @} */
 
 
+/***************************************************************************************************
+ * @brief       DMA stream register structure
+ * 
+ * @details     This structure represents the registers of one of the eight streams of a DMA
+ *              controller.
+ * 
+ * @defgroup    dma_stream_reg DMA Stream
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __IO uint32_t CR;             /**< 0x00 (R/W) Configuration */
+  __IO uint32_t NDTR;           /**< 0x04 (R/W) Number of data items */
+  __IO uint32_t PAR;            /**< 0x08 (R/W) Peripheral address */
+  __IO uint32_t M0AR;           /**< 0x0C (R/W) Memory 0 address */
+  __IO uint32_t M1AR;           /**< 0x10 (R/W) Memory 1 address */
+  __IO uint32_t FCR;            /**< 0x14 (R/W) FIFO control */
+} DMA_Stream_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       DMA register structure
+ * 
+ * @details     This structure represents the DMA controller register block: the interrupt status
+ *              and flag clear registers of streams 0-3 (low) and 4-7 (high), followed by the
+ *              registers of every stream.
+ * 
+ * @defgroup    dma_reg DMA
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __I  uint32_t LISR;           /**< 0x00 (R) Low interrupt status */
+  __I  uint32_t HISR;           /**< 0x04 (R) High interrupt status */
+  __O  uint32_t LIFCR;          /**< 0x08 (W) Low interrupt flag clear */
+  __O  uint32_t HIFCR;          /**< 0x0C (W) High interrupt flag clear */
+  DMA_Stream_Type S[8];         /**< 0x10-0xCC Streams 0-7 */
+} DMA_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       ADC register structure
+ * 
+ * @details     This structure represents the ADC1 register block: status, control, sample time
+ *              and sequence registers of the regular and injected groups, and the data register.
+ * 
+ * @defgroup    adc_reg ADC
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __IO uint32_t SR;             /**< 0x00 (R/W) Status */
+  __IO uint32_t CR1;            /**< 0x04 (R/W) Control 1 */
+  __IO uint32_t CR2;            /**< 0x08 (R/W) Control 2 */
+  __IO uint32_t SMPR1;          /**< 0x0C (R/W) Sample time 1 (channels 10-18) */
+  __IO uint32_t SMPR2;          /**< 0x10 (R/W) Sample time 2 (channels 0-9) */
+  __IO uint32_t JOFR[4];        /**< 0x14-0x20 (R/W) Injected channel data offset [1..4] */
+  __IO uint32_t HTR;            /**< 0x24 (R/W) Watchdog higher threshold */
+  __IO uint32_t LTR;            /**< 0x28 (R/W) Watchdog lower threshold */
+  __IO uint32_t SQR1;           /**< 0x2C (R/W) Regular sequence 1 (length, SQ13-SQ16) */
+  __IO uint32_t SQR2;           /**< 0x30 (R/W) Regular sequence 2 (SQ7-SQ12) */
+  __IO uint32_t SQR3;           /**< 0x34 (R/W) Regular sequence 3 (SQ1-SQ6) */
+  __IO uint32_t JSQR;           /**< 0x38 (R/W) Injected sequence */
+  __I  uint32_t JDR[4];         /**< 0x3C-0x48 (R) Injected data [1..4] */
+  __I  uint32_t DR;             /**< 0x4C (R) Regular data */
+} ADC_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       ADC common register structure
+ * 
+ * @details     This structure represents the ADC common registers, which hold the clock
+ *              prescaler and the enables of the temperature sensor, VREFINT and VBAT channels.
+ * 
+ * @defgroup    adc_common_reg ADC Common
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __I  uint32_t CSR;            /**< 0x00 (R) Common status */
+  __IO uint32_t CCR;            /**< 0x04 (R/W) Common control */
+} ADC_Common_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       TIM register structure
+ * 
+ * @details     This structure represents the register block shared by the advanced-control (TIM1)
+ *              and general-purpose (TIM5, TIM9, TIM11) timers, as well as the basic timer TIM6.
+ *              Registers not implemented by a given timer read as zero.
+ * 
+ * @defgroup    tim_reg TIM
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __IO uint32_t CR1;            /**< 0x00 (R/W) Control 1 */
+  __IO uint32_t CR2;            /**< 0x04 (R/W) Control 2 */
+  __IO uint32_t SMCR;           /**< 0x08 (R/W) Slave mode control */
+  __IO uint32_t DIER;           /**< 0x0C (R/W) DMA/Interrupt enable */
+  __IO uint32_t SR;             /**< 0x10 (R/W) Status */
+  __IO uint32_t EGR;            /**< 0x14 (W) Event generation */
+  __IO uint32_t CCMR1;          /**< 0x18 (R/W) Capture/compare mode 1 */
+  __IO uint32_t CCMR2;          /**< 0x1C (R/W) Capture/compare mode 2 */
+  __IO uint32_t CCER;           /**< 0x20 (R/W) Capture/compare enable */
+  __IO uint32_t CNT;            /**< 0x24 (R/W) Counter */
+  __IO uint32_t PSC;            /**< 0x28 (R/W) Prescaler */
+  __IO uint32_t ARR;            /**< 0x2C (R/W) Auto-reload */
+  __IO uint32_t RCR;            /**< 0x30 (R/W) Repetition counter */
+  __IO uint32_t CCR[4];         /**< 0x34-0x40 (R/W) Capture/compare [1..4] */
+  __IO uint32_t BDTR;           /**< 0x44 (R/W) Break and dead-time */
+  __IO uint32_t DCR;            /**< 0x48 (R/W) DMA control */
+  __IO uint32_t DMAR;           /**< 0x4C (R/W) DMA address for full transfer */
+  __IO uint32_t OR;             /**< 0x50 (R/W) Option */
+} TIM_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       LPTIM register structure
+ * 
+ * @details     This structure represents the register block of the low-power timer LPTIM1, which
+ *              keeps counting in Stop mode when it is clocked from LSI, LSE or HSI.
+ * 
+ * @defgroup    lptim_reg LPTIM
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __I  uint32_t ISR;            /**< 0x00 (R) Interrupt and status */
+  __O  uint32_t ICR;            /**< 0x04 (W) Interrupt clear */
+  __IO uint32_t IER;            /**< 0x08 (R/W) Interrupt enable */
+  __IO uint32_t CFGR;           /**< 0x0C (R/W) Configuration */
+  __IO uint32_t CR;             /**< 0x10 (R/W) Control */
+  __IO uint32_t CMP;            /**< 0x14 (R/W) Compare */
+  __IO uint32_t ARR;            /**< 0x18 (R/W) Autoreload */
+  __I  uint32_t CNT;            /**< 0x1C (R) Counter */
+  __IO uint32_t OR;             /**< 0x20 (R/W) Option */
+} LPTIM_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       DWT register structure
+ * 
+ * @details     This structure represents the Data Watchpoint and Trace unit register block, which
+ *              contains the cycle counter and the profiling event counters of the Cortex-M4.
+ * 
+ * @defgroup    dwt_reg DWT
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __IO uint32_t CTRL;           /**< 0x00 (R/W) Control */
+  __IO uint32_t CYCCNT;         /**< 0x04 (R/W) Cycle count */
+  __IO uint32_t CPICNT;         /**< 0x08 (R/W) CPI count */
+  __IO uint32_t EXCCNT;         /**< 0x0C (R/W) Exception overhead count */
+  __IO uint32_t SLEEPCNT;       /**< 0x10 (R/W) Sleep count */
+  __IO uint32_t LSUCNT;         /**< 0x14 (R/W) LSU count */
+  __IO uint32_t FOLDCNT;        /**< 0x18 (R/W) Folded-instruction count */
+  __I  uint32_t PCSR;           /**< 0x1C (R) Program counter sample */
+} DWT_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       DCB register structure
+ * 
+ * @details     This structure represents the Debug Control Block register block, whose DEMCR
+ *              register gates the clock of the DWT and ITM units.
+ * 
+ * @defgroup    dcb_reg DCB
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __IO uint32_t DHCSR;          /**< 0x00 (R/W) Debug halting control and status */
+  __O  uint32_t DCRSR;          /**< 0x04 (W) Debug core register selector */
+  __IO uint32_t DCRDR;          /**< 0x08 (R/W) Debug core register data */
+  __IO uint32_t DEMCR;          /**< 0x0C (R/W) Debug exception and monitor control */
+} DCB_Type;
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       FPU register structure
+ * 
+ * @details     This structure represents the floating-point extension registers of the System
+ *              Control Block that configure the lazy stacking of the FPU context. The access to
+ *              the FPU itself is enabled in SCB->CPACR.
+ * 
+ * @defgroup    fpu_reg FPU
+ * @ingroup     register_type
+ * @{
+ */
+typedef struct {
+  __IO uint32_t FPCCR;          /**< 0x00 (R/W) Floating-point context control */
+  __IO uint32_t FPCAR;          /**< 0x04 (R/W) Floating-point context address */
+  __IO uint32_t FPDSCR;         /**< 0x08 (R/W) Floating-point default status control */
+} FPU_Type;
+/** @} */
+
+
 /***************************************************************************************************
  * @defgroup    base_addr Register Base Addresses
  * @ingroup     reg_def
@@ -271,18 +528,23 @@ typedef struct {
 #define GPIOC_BASE_ADDR     (0x40020800UL)
 #define GPIOH_BASE_ADDR     (0x40021C00UL)
 #define SYSCFG_BASE_ADDR    (0x40013800UL)
-// DMA
+#define DMA1_BASE_ADDR      (0x40026000UL)
+#define DMA2_BASE_ADDR      (0x40026400UL)
 #define NVIC_BASE_ADDR      (0xE000E100UL)
+#define SCB_BASE_ADDR       (0xE000ED00UL)
+#define SYSTICK_BASE_ADDR   (0xE000E010UL)
 #define EXTI_BASE_ADDR      (0x40013C00UL)
 // CRC
-// ADC
+#define ADC1_BASE_ADDR      (0x40012000UL)
+#define ADC_COMMON_BASE_ADDR (0x40012300UL)
 // DAC
 // RNG
-// TIM1
-// TIM5
-// TIM9 and TIM11
-// TIM6
-// LPTIM
+#define TIM1_BASE_ADDR      (0x40010000UL)
+#define TIM5_BASE_ADDR      (0x40000C00UL)
+#define TIM9_BASE_ADDR      (0x40014000UL)
+#define TIM11_BASE_ADDR     (0x40014800UL)
+#define TIM6_BASE_ADDR      (0x40001000UL)
+#define LPTIM1_BASE_ADDR    (0x40002400UL)
 // WWDG
 // IWDG
 // RTC
@@ -293,6 +555,9 @@ typedef struct {
 #define USART6_BASE_ADDR    (0x40011400UL)
 // SPI
 // DBG
+#define DWT_BASE_ADDR       (0xE0001000UL)
+#define DCB_BASE_ADDR       (0xE000EDF0UL)
+#define FPU_BASE_ADDR       (0xE000EF34UL)
 /** @} */
 
 
@@ -309,11 +574,26 @@ typedef struct {
 #define GPIOC               ((GPIO_Type*)   GPIOC_BASE_ADDR)
 #define GPIOH               ((GPIO_Type*)   GPIOH_BASE_ADDR)
 #define SYSCFG              ((SYSCFG_Type*) SYSCFG_BASE_ADDR)
+#define DMA1                ((DMA_Type*)    DMA1_BASE_ADDR)
+#define DMA2                ((DMA_Type*)    DMA2_BASE_ADDR)
 #define NVIC                ((NVIC_Type*)   NVIC_BASE_ADDR)
+#define SCB                 ((SCB_Type*)    SCB_BASE_ADDR)
+#define SYSTICK             ((SysTick_Type*) SYSTICK_BASE_ADDR)
 #define EXTI                ((EXTI_Type*)   EXTI_BASE_ADDR)
+#define ADC1                ((ADC_Type*)    ADC1_BASE_ADDR)
+#define ADC_COMMON          ((ADC_Common_Type*) ADC_COMMON_BASE_ADDR)
+#define TIM1                ((TIM_Type*)    TIM1_BASE_ADDR)
+#define TIM5                ((TIM_Type*)    TIM5_BASE_ADDR)
+#define TIM9                ((TIM_Type*)    TIM9_BASE_ADDR)
+#define TIM11               ((TIM_Type*)    TIM11_BASE_ADDR)
+#define TIM6                ((TIM_Type*)    TIM6_BASE_ADDR)
+#define LPTIM1              ((LPTIM_Type*)  LPTIM1_BASE_ADDR)
 #define USART1              ((USART_Type*)  USART1_BASE_ADDR)
 #define USART2              ((USART_Type*)  USART2_BASE_ADDR)
 #define USART6              ((USART_Type*)  USART6_BASE_ADDR)
+#define DWT                 ((DWT_Type*)    DWT_BASE_ADDR)
+#define DCB                 ((DCB_Type*)    DCB_BASE_ADDR)
+#define FPU                 ((FPU_Type*)    FPU_BASE_ADDR)
 /** @} */
 
 
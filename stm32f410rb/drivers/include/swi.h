@@ -0,0 +1,113 @@
+/***************************************************************************************************
+ * @file        swi.h
+ * @defgroup    swi swi.h
+ *
+ * @brief       Header file for the software interrupt service.
+ *
+ * @details     This file provides the definitions and functions to defer work from interrupt
+ *              handlers to lower priority software interrupts. A handler that must stay short
+ *              does the minimum (read the data register, clear the flag...) and calls swiTrigger(),
+ *              which records its event bits and pends a vector that no peripheral uses through the
+ *              NVIC STIR register. The NVIC runs the deferred handler as soon as no interrupt of
+ *              the same or more urgent priority is active, usually tail-chained to the one that
+ *              triggered it, and preempts it like any other interrupt. Each channel has its own
+ *              priority, so deferred work is prioritized with no scheduler involved.
+ *
+ *              Triggers that happen before the deferred handler runs are merged: the handler is
+ *              called once with the OR of all their event bits.
+ *
+ *              The channels use these vectors of the startup.c table, which no peripheral pends
+ *              while the mask bit of their EXTI line is left cleared or no FPU exception occurs:
+ *
+ *              - kSwi0: EXTI19_ISR.
+ *              - kSwi1: EXTI20_ISR.
+ *              - kSwi2: FPU_ISR. The FPU also pends it when a floating-point exception flag is
+ *                set; the handler clears the flags and only runs the deferred handler for events.
+ *
+ * @note        Deferred handlers may call other drivers, so their priority must be
+ *              CRITICAL_DRIVER_PRIORITY or higher (see atomic.h).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SWI_H
+#define SWI_H
+
+
+#include <stdint.h>
+
+
+/***************************************************************************************************
+ * @brief       Software interrupt channels.
+ *
+ * @ingroup     swi
+ */
+typedef enum {
+  kSwi0 = 0,
+  kSwi1,
+  kSwi2,
+  kSwiCount
+} SwiChannel;
+
+
+/***************************************************************************************************
+ * @brief       Deferred handler, called with the event bits of the triggers merged since its last
+ *              call.
+ *
+ * @ingroup     swi
+ */
+typedef void (*SwiHandler)(uint32_t events);
+
+
+/**
+ * @defgroup    swi_func Software Interrupt Functions
+ * @ingroup     swi
+ */
+
+
+/***************************************************************************************************
+ * @brief       Sets the handler and priority of a channel and enables it.
+ *
+ * @param       channel   The channel.
+ * @param       priority  The interrupt priority. (CRITICAL_DRIVER_PRIORITY - 15)
+ * @param       handler   The deferred handler.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     swi_func
+ */
+int swiInit(SwiChannel channel, uint8_t priority, SwiHandler handler);
+
+
+/***************************************************************************************************
+ * @brief       Adds event bits to a channel and pends its handler. Can be called from any
+ *              interrupt handler and from the main code.
+ *
+ * @param       channel   The channel, initialized with swiInit(). (kSwi0 - kSwiCount - 1)
+ * @param       events    Bits passed to the handler, must not be 0.
+ *
+ * @ingroup     swi_func
+ */
+void swiTrigger(SwiChannel channel, uint32_t events);
+
+
+#endif
@@ -0,0 +1,156 @@
+/***************************************************************************************************
+ * @file        swtimer.h
+ * @defgroup    swtimer swtimer.h
+ *
+ * @brief       Header file for the software timer service.
+ *
+ * @details     This file provides the definitions and functions for any number of one-shot and
+ *              periodic software timers driven by a single hardware tick. The application calls
+ *              swtimerTick() from the interrupt handler of its tick source (SysTick, TIM6...).
+ *
+ *              Timers are kept in a hierarchical timing wheel: 4 levels of 64 slots, each level
+ *              covering 64 times the range of the previous one. A timer is placed in the slot of
+ *              the lowest level that can hold its expiry time, and moved down one level when the
+ *              wheel reaches its slot. Starting, stopping and expiring a timer are O(1), and a
+ *              tick only touches the timers that expire or cascade on that tick, so its cost does
+ *              not grow with the number of timers that are merely waiting.
+ *
+ *              While any timer is running a Stop mode lock is held (see lpm.h), since neither
+ *              SysTick nor the timers count in Stop mode.
+ *
+ * @note        Timer structures are owned by the application and must stay allocated while the
+ *              timer is running. Callbacks run inside the tick interrupt handler. The tick
+ *              interrupt, and any interrupt handler that starts or stops timers, must have a
+ *              priority value of CRITICAL_DRIVER_PRIORITY or higher (see atomic.h).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SWTIMER_H
+#define SWTIMER_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    swtimer_def Software Timer Definitions
+ * @ingroup     swtimer
+ * @{
+ */
+#define SWTIMER_LEVEL_BITS  (6U)                          /**< log2 of the slots per level */
+#define SWTIMER_LEVELS      (4U)                          /**< Number of wheel levels */
+#define SWTIMER_MAX_TICKS   ((1UL << (SWTIMER_LEVEL_BITS * SWTIMER_LEVELS)) - 1)  /**< Max delay */
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Timer callback, called from the tick interrupt handler.
+ *
+ * @ingroup     swtimer
+ */
+typedef void (*SwTimerCallback)(void *arg);
+
+
+/***************************************************************************************************
+ * @brief       Software timer. Fields are private, initialize it with swtimerInit().
+ *
+ * @ingroup     swtimer
+ */
+typedef struct SwTimer {
+  struct SwTimer *next;
+  struct SwTimer **pprev;             /**< Link that points to this timer, NULL when stopped */
+  uint32_t expires;                   /**< Tick on which the timer expires */
+  uint32_t period;                    /**< Reload value in ticks, 0 for one-shot timers */
+  SwTimerCallback callback;
+  void *arg;
+} SwTimer;
+
+
+/**
+ * @defgroup    swtimer_func Software Timer Functions
+ * @ingroup     swtimer
+ */
+
+
+/***************************************************************************************************
+ * @brief       Initializes a timer in the stopped state.
+ *
+ * @param       timer     The timer.
+ * @param       callback  Function called when the timer expires.
+ * @param       arg       Argument passed to the callback.
+ *
+ * @ingroup     swtimer_func
+ */
+void swtimerInit(SwTimer *timer, SwTimerCallback callback, void *arg);
+
+
+/***************************************************************************************************
+ * @brief       Starts (or restarts) a timer. Can be called from interrupt handlers and callbacks.
+ *
+ * @param       timer     The timer.
+ * @param       ticks     Ticks until the first expiry. (1 - SWTIMER_MAX_TICKS)
+ * @param       period    Ticks between later expiries, 0 for a one-shot timer.
+ *                        (0 - SWTIMER_MAX_TICKS)
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ *
+ * @ingroup     swtimer_func
+ */
+int swtimerStart(SwTimer *timer, uint32_t ticks, uint32_t period);
+
+
+/***************************************************************************************************
+ * @brief       Stops a timer. Stopping a stopped timer does nothing. Can be called from interrupt
+ *              handlers and callbacks.
+ *
+ * @ingroup     swtimer_func
+ */
+void swtimerStop(SwTimer *timer);
+
+
+/***************************************************************************************************
+ * @brief       Returns 1 if the timer is running, 0 otherwise.
+ *
+ * @ingroup     swtimer_func
+ */
+int swtimerActive(const SwTimer *timer);
+
+
+/***************************************************************************************************
+ * @brief       Advances the wheel by one tick and runs the callbacks of the expired timers.
+ *              Must be called from a single interrupt handler.
+ *
+ * @ingroup     swtimer_func
+ */
+void swtimerTick(void);
+
+
+/***************************************************************************************************
+ * @brief       Returns the number of ticks processed so far.
+ *
+ * @ingroup     swtimer_func
+ */
+uint32_t swtimerNow(void);
+
+
+#endif
@@ -0,0 +1,172 @@
+/***************************************************************************************************
+ * @file        trace.h
+ * @defgroup    trace trace.h
+ *
+ * @brief       Header file for the binary event trace buffer.
+ *
+ * @details     This file provides the definitions and functions for recording timestamped events
+ *              (interrupt entry/exit, user markers and queue operations) into a ring buffer in
+ *              SRAM. Every record takes 8 bytes and is stamped with the DWT cycle counter.
+ *
+ *              Records are claimed with an exclusive load/store (LDREX/STREX) on the head index,
+ *              so the functions can be called from the main loop and from interrupt handlers of
+ *              any priority without disabling interrupts. When the buffer is full the oldest
+ *              records are overwritten, so the buffer always holds the latest TRACE_SIZE events.
+ *
+ *              The buffer is dumped with traceDump() or through the debugger and converted to a
+ *              Chrome/Perfetto timeline with the host tool in tools/tracedump.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRACE_H
+#define TRACE_H
+
+
+#include <stdint.h>
+
+
+/**
+ * @defgroup    trace_def Trace Definitions
+ * @ingroup     trace
+ * @{
+ */
+#define TRACE_MAGIC         (0x45435254UL)    /**< "TRCE" in little-endian byte order */
+#define TRACE_SIZE          (256U)            /**< Number of records, must be a power of two */
+/** @} */
+
+
+/***************************************************************************************************
+ * @brief       Trace record types.
+ *
+ * @ingroup     trace
+ */
+typedef enum {
+  kTraceIsrEnter,      /**< Interrupt handler entered, id = IRQ number. */
+  kTraceIsrExit,       /**< Interrupt handler left, id = IRQ number. */
+  kTraceMarker,        /**< User marker, arg = user value. */
+  kTraceQueuePut,      /**< Item added to a queue, arg = queue depth after the operation. */
+  kTraceQueueGet       /**< Item removed from a queue, arg = queue depth after the operation. */
+} TraceType;
+
+
+/***************************************************************************************************
+ * @brief       Trace record (8 bytes).
+ *
+ * @ingroup     trace
+ */
+typedef struct {
+  uint32_t cycles;     /**< DWT cycle counter when the event was recorded */
+  uint8_t type;        /**< Event type (from TraceType enum) */
+  uint8_t id;          /**< IRQ, marker or queue identifier */
+  uint16_t arg;        /**< Event argument */
+} TraceRecord;
+
+
+/***************************************************************************************************
+ * @brief       Trace ring buffer.
+ *
+ * @details     head counts every record ever claimed, the newest record is at
+ *              (head - 1) % TRACE_SIZE. The layout of this structure is the dump format read by
+ *              tools/tracedump, so fields must not be reordered.
+ *
+ * @ingroup     trace
+ */
+typedef struct {
+  uint32_t magic;                     /**< Always TRACE_MAGIC */
+  uint32_t head;                      /**< Number of records written since traceInit() */
+  uint32_t size;                      /**< Number of records in the ring (TRACE_SIZE) */
+  uint32_t enabled;                   /**< Recording enabled (1) or stopped (0) */
+  TraceRecord record[TRACE_SIZE];     /**< Ring of records */
+} TraceBuffer;
+
+
+/***************************************************************************************************
+ * @brief       Trace buffer, exposed so that it can also be read through the debugger.
+ *
+ * @ingroup     trace
+ */
+extern volatile TraceBuffer trace_buffer;
+
+
+/**
+ * @defgroup    trace_func Trace Functions
+ * @ingroup     trace
+ */
+
+
+/***************************************************************************************************
+ * @brief       Enables the DWT cycle counter, clears the buffer and starts recording.
+ *
+ * @ingroup     trace_func
+ */
+void traceInit(void);
+
+
+/***************************************************************************************************
+ * @brief       Stops recording so that the buffer can be dumped consistently.
+ *
+ * @ingroup     trace_func
+ */
+void traceStop(void);
+
+
+/***************************************************************************************************
+ * @brief       Records one event.
+ *
+ * @param       type  The event type. (from TraceType enum)
+ * @param       id    The IRQ, marker or queue identifier.
+ * @param       arg   The event argument.
+ *
+ * @ingroup     trace_func
+ */
+void traceRecord(TraceType type, uint8_t id, uint16_t arg);
+
+
+/***************************************************************************************************
+ * @brief       Writes the buffer header and the records to a byte sink.
+ *
+ * @param       put_byte  Function called once per byte, e.g. a blocking USART write.
+ *
+ * @ingroup     trace_func
+ */
+void traceDump(void (*put_byte)(uint8_t byte));
+
+
+/**
+ * @defgroup    trace_helpers Trace Helpers
+ * @ingroup     trace
+ * @{
+ */
+static inline void traceIsrEnter(uint8_t irq) { traceRecord(kTraceIsrEnter, irq, 0); }
+static inline void traceIsrExit(uint8_t irq) { traceRecord(kTraceIsrExit, irq, 0); }
+static inline void traceMarker(uint8_t id, uint16_t value) { traceRecord(kTraceMarker, id, value); }
+static inline void traceQueuePut(uint8_t queue, uint16_t depth) {
+  traceRecord(kTraceQueuePut, queue, depth);
+}
+static inline void traceQueueGet(uint8_t queue, uint16_t depth) {
+  traceRecord(kTraceQueueGet, queue, depth);
+}
+/** @} */
+
+
+#endif
@@ -0,0 +1,375 @@
+/***************************************************************************************************
+ * @file        adc.c
+ *
+ * @brief       Source file for the ADC driver.
+ *
+ * @details     This file implements the scan conversions of ADC1 into a circular DMA buffer:
+ *
+ *              - ADC1 in scan mode with DMA requests after the last transfer (DDS), so the DMA
+ *                keeps taking samples for as long as the ADC runs.
+ *              - DMA2 stream 0, channel 0 (ADC1), in circular mode from ADC1->DR to the buffer,
+ *                with the half-transfer and transfer-complete interrupts enabled.
+ *              - TIM5 in PWM mode 1 with CCR1 at half the period: the rising edge of OC1REF at
+ *                every update is the external trigger of the ADC (EXTSEL TIM5_CC1). The output
+ *                compare must be enabled (CC1E) for the event to reach the ADC, but PA0 is left
+ *                alone, so the pin stays free for analog use.
+ *
+ *              An overrun stops the DMA requests of the ADC. It is handled in ADC_ISR by
+ *              restarting the DMA stream and the requests, as the reference manual describes, and
+ *              a DMA transfer error the same way.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "adc.h"
+#include "err.h"
+#include "clk.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "perf.h"
+#include "lpm.h"
+
+
+#define ADC_SR_OVR          (1UL << 5)
+#define ADC_CR1_SCAN        (1UL << 8)
+#define ADC_CR1_OVRIE       (1UL << 26)
+#define ADC_CR2_ADON        (1UL << 0)
+#define ADC_CR2_CONT        (1UL << 1)
+#define ADC_CR2_DMA         (1UL << 8)
+#define ADC_CR2_DDS         (1UL << 9)
+#define ADC_CR2_EXTSEL_TIM5_CC1 (0xAUL << 24)
+#define ADC_CR2_EXTEN_RISING    (1UL << 28)
+#define ADC_CR2_SWSTART     (1UL << 30)
+#define ADC_CCR_ADCPRE_POS  (16U)
+#define ADC_CCR_VBATE       (1UL << 22)
+#define ADC_CCR_TSVREFE     (1UL << 23)
+#define ADC_CONVERSION_CYCLES (12U)   // 12-bit resolution
+#define ADC_STAB_US         (3U)      // tSTAB after ADON
+
+#define DMA_CR_EN           (1UL << 0)
+#define DMA_CR_TEIE         (1UL << 2)
+#define DMA_CR_HTIE         (1UL << 3)
+#define DMA_CR_TCIE         (1UL << 4)
+#define DMA_CR_CIRC         (1UL << 8)
+#define DMA_CR_MINC         (1UL << 10)
+#define DMA_CR_PSIZE_16     (1UL << 11)
+#define DMA_CR_MSIZE_16     (1UL << 13)
+#define DMA_CR_PL_HIGH      (2UL << 16)
+#define DMA_ISR_TEIF0       (1UL << 3)
+#define DMA_ISR_HTIF0       (1UL << 4)
+#define DMA_ISR_TCIF0       (1UL << 5)
+#define DMA_IFCR_ALL0       (0x3DUL)  // Every flag of stream 0
+
+#define TIM_CR1_CEN         (1UL << 0)
+#define TIM_EGR_UG          (1UL << 0)
+#define TIM_CCMR1_OC1_PWM1  (6UL << 4)
+#define TIM_CCER_CC1E       (1UL << 0)
+
+#define ADC_STREAM          (&DMA2->S[0])
+
+
+static const uint16_t adc_sample_cycles[] = { 3, 15, 28, 56, 84, 112, 144, 480 };
+
+static uint16_t *adc_buffer;
+static uint16_t adc_half_length;
+static uint8_t adc_count;
+static AdcSampleTime adc_sample_time;
+static AdcHandler adc_handler;
+static uint8_t adc_clock_refs;    // Whether the ADC1 and DMA2 clocks are referenced
+static uint8_t adc_timer_ref;     // Whether the TIM5 clock is referenced
+static uint8_t adc_stop_lock;     // Whether Stop mode is locked while converting
+static volatile uint32_t adc_overruns;
+static volatile uint32_t adc_dma_errors;
+
+
+/***************************************************************************************************
+ * @brief       Sets a channel pin to analog mode. The internal channels have no pin.
+ */
+static int adcPinSetup(uint8_t channel) {
+  if (channel < 8) return gpioPinSetup(GPIOA, channel, kModeAnalog);
+  if (channel < 10) return gpioPinSetup(GPIOB, channel - 8, kModeAnalog);
+  if (channel < 16) return gpioPinSetup(GPIOC, channel - 10, kModeAnalog);
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @brief       Returns the divider of PCLK2 for the ADC clock, the smallest one within 36 MHz.
+ */
+static uint32_t adcPrescaler(void) {
+  uint32_t div = 2;
+
+  while (div < 8 && perfApb2Hz() / div > ADC_MAX_CLOCK_HZ) div += 2;
+  return div;
+}
+
+
+/***************************************************************************************************
+ * @brief       Returns the clock of TIM5: twice PCLK1 when APB1 is divided.
+ */
+static uint32_t adcTimerHz(void) {
+  return (perfApb1Hz() == perfHclkHz()) ? perfApb1Hz() : 2 * perfApb1Hz();
+}
+
+
+/***************************************************************************************************
+ * @brief       Programs DMA2 stream 0 from the start of the buffer and enables it.
+ */
+static void adcDmaStart(void) {
+  ADC_STREAM->CR &= ~DMA_CR_EN;
+  while (ADC_STREAM->CR & DMA_CR_EN) {}
+  DMA2->LIFCR = DMA_IFCR_ALL0;
+
+  ADC_STREAM->PAR = (uint32_t)&ADC1->DR;
+  ADC_STREAM->M0AR = (uint32_t)adc_buffer;
+  ADC_STREAM->NDTR = 2 * (uint32_t)adc_half_length;
+  ADC_STREAM->FCR = 0;                                    // Direct mode
+  ADC_STREAM->CR = DMA_CR_PL_HIGH | DMA_CR_MSIZE_16 | DMA_CR_PSIZE_16 | DMA_CR_MINC |
+                   DMA_CR_CIRC | DMA_CR_TCIE | DMA_CR_HTIE | DMA_CR_TEIE;  // Channel 0, to memory
+  ADC_STREAM->CR |= DMA_CR_EN;
+}
+
+
+/***************************************************************************************************
+ * @brief       Restarts the DMA requests after an overrun or a DMA transfer error, from the start
+ *              of the buffer.
+ *
+ * @details     After an overrun the ADC stops issuing DMA requests, and after a transfer error the
+ *              stream disables itself. In continuous mode the conversions have stopped too, and
+ *              are started again.
+ */
+static void adcRecover(void) {
+  ADC1->CR2 &= ~ADC_CR2_DMA;
+  ADC1->SR = ~ADC_SR_OVR;
+  adcDmaStart();
+  ADC1->CR2 |= ADC_CR2_DMA;
+  if (ADC1->CR2 & ADC_CR2_CONT) ADC1->CR2 |= ADC_CR2_SWSTART;
+}
+
+
+/***************************************************************************************************
+ * @details     Any previous conversions are stopped. The sample time is set for every channel of
+ *              the sequence, which may repeat channels.
+ */
+int adcInit(const uint8_t *channels, uint8_t count, AdcSampleTime sample_time, uint16_t *buffer,
+            uint16_t half_length, uint8_t priority, AdcHandler handler) {
+  if (channels == NULL || count == 0 || count > ADC_MAX_SEQUENCE || sample_time > kAdcSample480) {
+    triggerError(12, 1); // Wrong sequence
+    return 1;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    if (channels[i] >= ADC_CHANNELS) {
+      triggerError(12, 1); // Wrong sequence
+      return 1;
+    }
+  }
+  if (buffer == NULL || handler == NULL || half_length == 0 || half_length > ADC_MAX_HALF_LENGTH ||
+      half_length % count != 0) {
+    triggerError(12, 2); // Wrong buffer or handler
+    return 1;
+  }
+  if (priority > 15) {
+    triggerError(12, 3); // Wrong priority
+    return 1;
+  }
+
+  if (!adc_clock_refs) {
+    if (clkEnable(kClkAdc1)) return 1;
+    if (clkEnable(kClkDma2)) return 1;
+    adc_clock_refs = 1;
+  }
+  adcStop();
+
+  for (uint32_t i = 0; i < count; i++) {
+    if (adcPinSetup(channels[i])) return 1;
+  }
+
+  uint32_t smpr1 = 0, smpr2 = 0, sqr[3] = { 0, 0, 0 }, ccr = 0;
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t channel = channels[i];
+
+    if (channel < 10)
+      smpr2 |= (uint32_t)sample_time << (3 * channel);
+    else
+      smpr1 |= (uint32_t)sample_time << (3 * (channel - 10));
+
+    sqr[2 - i / 6] |= (uint32_t)channel << (5 * (i % 6));  // SQ1-SQ6 in SQR3, SQ7-SQ12 in SQR2...
+
+    if (channel == 16 || channel == 17) ccr |= ADC_CCR_TSVREFE;
+    if (channel == 18) ccr |= ADC_CCR_VBATE;
+  }
+
+  ADC_COMMON->CCR = ccr | ((adcPrescaler() / 2 - 1) << ADC_CCR_ADCPRE_POS);
+  ADC1->SMPR1 = smpr1;
+  ADC1->SMPR2 = smpr2;
+  ADC1->SQR3 = sqr[2];
+  ADC1->SQR2 = sqr[1];
+  ADC1->SQR1 = sqr[0] | ((uint32_t)(count - 1) << 20);
+  ADC1->CR1 = ADC_CR1_SCAN | ADC_CR1_OVRIE;                // 12-bit resolution
+
+  adc_buffer = buffer;
+  adc_half_length = half_length;
+  adc_count = count;
+  adc_sample_time = sample_time;
+  adc_handler = handler;
+  adc_overruns = 0;
+  adc_dma_errors = 0;
+
+  nvicSetPriority(kIrqDma2Stream0, priority);
+  nvicSetPriority(kIrqAdc, priority);
+  nvicClearPending(kIrqDma2Stream0);
+  nvicClearPending(kIrqAdc);
+  nvicEnable(kIrqDma2Stream0);
+  nvicEnable(kIrqAdc);
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     The ADC is powered on here and waits tSTAB (3 us) before the first trigger. In
+ *              timer mode the sequence rate is rounded to a whole number of timer clock cycles.
+ */
+int adcStart(uint32_t rate_hz) {
+  if (adc_handler == NULL) {
+    triggerError(12, 5); // Not initialized
+    return 1;
+  }
+  if (rate_hz > adcMaxRate() || (rate_hz != 0 && adcTimerHz() / rate_hz < 2)) {
+    triggerError(12, 4); // Wrong rate
+    return 1;
+  }
+
+  adcStop();
+  adcDmaStart();
+
+  lpmStopLock();                  // ADC, DMA and TIM5 stop in Stop mode
+  adc_stop_lock = 1;
+
+  uint32_t stab_loops = perfHclkHz() / 1000000 * ADC_STAB_US;
+
+  ADC1->CR2 = ADC_CR2_ADON;
+  for (volatile uint32_t i = 0; i < stab_loops; i++) {}
+  ADC1->SR = 0;
+
+  if (rate_hz == 0) {
+    ADC1->CR2 = ADC_CR2_ADON | ADC_CR2_CONT | ADC_CR2_DMA | ADC_CR2_DDS;
+    ADC1->CR2 |= ADC_CR2_SWSTART;
+    return 0;
+  }
+
+  if (!adc_timer_ref) {
+    if (clkEnable(kClkTim5)) return 1;
+    adc_timer_ref = 1;
+  }
+
+  uint32_t period = adcTimerHz() / rate_hz;
+
+  TIM5->CR1 = 0;
+  TIM5->PSC = 0;
+  TIM5->ARR = period - 1;
+  TIM5->CCR[0] = period / 2;
+  TIM5->CCMR1 = TIM_CCMR1_OC1_PWM1;
+  TIM5->CCER = TIM_CCER_CC1E;
+  TIM5->EGR = TIM_EGR_UG;
+
+  ADC1->CR2 = ADC_CR2_ADON | ADC_CR2_DMA | ADC_CR2_DDS | ADC_CR2_EXTSEL_TIM5_CC1 |
+              ADC_CR2_EXTEN_RISING;
+  TIM5->CR1 = TIM_CR1_CEN;
+  return 0;
+}
+
+
+/**************************************************************************************************/
+void adcStop(void) {
+  if (adc_timer_ref) {
+    TIM5->CR1 = 0;
+    TIM5->CCER = 0;
+    clkRelease(kClkTim5);
+    adc_timer_ref = 0;
+  }
+  if (adc_clock_refs) {
+    ADC1->CR2 = 0;                                        // Also powers the ADC down
+    ADC_STREAM->CR &= ~DMA_CR_EN;
+    while (ADC_STREAM->CR & DMA_CR_EN) {}
+    DMA2->LIFCR = DMA_IFCR_ALL0;
+  }
+  if (adc_stop_lock) {
+    lpmStopUnlock();
+    adc_stop_lock = 0;
+  }
+}
+
+
+/***************************************************************************************************
+ * @details     Every conversion of the sequence takes the sample time plus 12 ADC clock cycles.
+ */
+uint32_t adcMaxRate(void) {
+  if (adc_count == 0) return 0;
+
+  uint32_t cycles = adc_count * (adc_sample_cycles[adc_sample_time] + ADC_CONVERSION_CYCLES);
+
+  return perfApb2Hz() / adcPrescaler() / cycles;
+}
+
+
+/**************************************************************************************************/
+uint32_t adcOverruns(void) {
+  return adc_overruns;
+}
+
+
+/**************************************************************************************************/
+uint32_t adcDmaErrors(void) {
+  return adc_dma_errors;
+}
+
+
+/***************************************************************************************************
+ * @details     The flags are read and cleared at once, so if both halves were filled since the
+ *              last interrupt (the handler took too long) both are passed, in order.
+ */
+void DMA2_Stream0_ISR(void) {
+  uint32_t flags = DMA2->LISR & (DMA_ISR_TEIF0 | DMA_ISR_HTIF0 | DMA_ISR_TCIF0);
+
+  DMA2->LIFCR = flags;
+
+  if (flags & DMA_ISR_TEIF0) {
+    adc_dma_errors++;
+    adcRecover();
+    return;
+  }
+  if (flags & DMA_ISR_HTIF0) adc_handler(adc_buffer, adc_half_length);
+  if (flags & DMA_ISR_TCIF0) adc_handler(adc_buffer + adc_half_length, adc_half_length);
+}
+
+
+/**************************************************************************************************/
+void ADC_ISR(void) {
+  if (ADC1->SR & ADC_SR_OVR) {
+    adc_overruns++;
+    adcRecover();
+  }
+}
@@ -0,0 +1,155 @@
+/***************************************************************************************************
+ * @file        clk.c
+ *
+ * @brief       Source file for the peripheral clock gating manager.
+ *
+ * @details     This file implements the reference counts of the peripheral clocks. The enable bits
+ *              are written through their bit-band alias, so the other bits of the RCC registers
+ *              (possibly written by code that does not use this module) are never read back and
+ *              rewritten. The counts are updated inside a critical section because the enable bit
+ *              has to follow them.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+#include "clk.h"
+#include "err.h"
+#include "atomic.h"
+#include "bitband.h"
+
+
+#define CLK_BUS(peripheral)   ((uint32_t)(peripheral) >> 5)
+#define CLK_BIT(peripheral)   ((uint32_t)(peripheral) & 31)
+
+
+// Bits of the enable registers that belong to a peripheral, one mask per bus
+static const uint32_t clk_valid[CLK_BUSES] = {
+  0x80601087UL,   // AHB1: GPIOA-C, GPIOH, CRC, DMA1, DMA2, RNG
+  0x31624E18UL,   // APB1: TIM5, TIM6, LPTIM1, RTCAPB, WWDG, SPI2, USART2, I2C1, I2C2, I2C4, PWR, DAC
+  0x0015D131UL    // APB2: TIM1, USART1, USART6, ADC1, SPI1, SYSCFG, EXTIT, TIM9, TIM11, SPI5
+};
+
+static uint8_t clk_refs[CLK_BUSES * 32];
+
+
+/***************************************************************************************************
+ * @brief       Checks that the value is one of the ClkPeripheral enumeration.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ */
+static int checkClkPeripheral(ClkPeripheral peripheral) {
+  if (CLK_BUS(peripheral) < CLK_BUSES &&
+      (clk_valid[CLK_BUS(peripheral)] & (1UL << CLK_BIT(peripheral)))) {
+    return 0;
+  }
+
+  triggerError(9, 1); // Wrong peripheral
+  return 1;
+}
+
+
+/***************************************************************************************************
+ * @brief       Returns the enable register of the bus of a peripheral.
+ */
+static volatile uint32_t *clkEnableRegister(ClkPeripheral peripheral) {
+  switch (CLK_BUS(peripheral)) {
+    case 0: return &RCC->AHB1ENR;
+    case 1: return &RCC->APB1ENR;
+    default: return &RCC->APB2ENR;
+  }
+}
+
+
+/***************************************************************************************************
+ * @brief       Returns the low power enable register of the bus of a peripheral.
+ */
+static volatile uint32_t *clkSleepRegister(ClkPeripheral peripheral) {
+  switch (CLK_BUS(peripheral)) {
+    case 0: return &RCC->AHB1LPENR;
+    case 1: return &RCC->APB1LPENR;
+    default: return &RCC->APB2LPENR;
+  }
+}
+
+
+/***************************************************************************************************
+ * @details     The enable register is read back after setting the bit. The read cannot complete
+ *              before the write has reached RCC, and by then the clock runs, which covers the
+ *              2-cycle delay required between enabling a clock and accessing the peripheral.
+ */
+int clkEnable(ClkPeripheral peripheral) {
+  if (checkClkPeripheral(peripheral)) return 1;
+
+  volatile uint32_t *enr = clkEnableRegister(peripheral);
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  if (clk_refs[peripheral] == UINT8_MAX) {
+    criticalExit(basepri);
+    triggerError(9, 2); // Too many references
+    return 1;
+  }
+  if (clk_refs[peripheral]++ == 0) {
+    BITBAND_PERIPH(*enr, CLK_BIT(peripheral)) = 1;
+    (void)*enr;
+  }
+  criticalExit(basepri);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+int clkRelease(ClkPeripheral peripheral) {
+  if (checkClkPeripheral(peripheral)) return 1;
+
+  volatile uint32_t *enr = clkEnableRegister(peripheral);
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  if (clk_refs[peripheral] == 0) {
+    criticalExit(basepri);
+    triggerError(9, 3); // Released more times than enabled
+    return 1;
+  }
+  if (--clk_refs[peripheral] == 0) {
+    BITBAND_PERIPH(*enr, CLK_BIT(peripheral)) = 0;
+  }
+  criticalExit(basepri);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+int clkEnabled(ClkPeripheral peripheral) {
+  if (checkClkPeripheral(peripheral)) return 0;
+
+  return (*clkEnableRegister(peripheral) >> CLK_BIT(peripheral)) & 1;
+}
+
+
+/**************************************************************************************************/
+int clkSetSleep(ClkPeripheral peripheral, uint8_t enabled) {
+  if (checkClkPeripheral(peripheral)) return 1;
+
+  BITBAND_PERIPH(*clkSleepRegister(peripheral), CLK_BIT(peripheral)) = (enabled != 0);
+  return 0;
+}
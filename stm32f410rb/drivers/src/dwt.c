@@ -0,0 +1,69 @@
+/***************************************************************************************************
+ * @file        dwt.c
+ *
+ * @brief       Source file for the DWT cycle counter.
+ *
+ * @details     The DWT unit is powered by the TRCENA bit of DCB->DEMCR, which is also set by a
+ *              debugger when it connects. The counter is never cleared here, so a module that
+ *              calls dwtInit() does not disturb the measurements of another one.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+#include "dwt.h"
+
+
+#define DCB_DEMCR_TRCENA    (1UL << 24)
+#define DWT_CTRL_CYCCNTENA  (1UL << 0)
+
+
+/**************************************************************************************************/
+void dwtInit(void) {
+  DCB->DEMCR |= DCB_DEMCR_TRCENA;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+
+/**************************************************************************************************/
+void dwtStatsReset(volatile DwtStats *stats) {
+  stats->samples = 0;
+  stats->min = UINT32_MAX;
+  stats->max = 0;
+  stats->total = 0;
+}
+
+
+/**************************************************************************************************/
+void dwtStatsAdd(volatile DwtStats *stats, uint32_t cycles) {
+  if (cycles < stats->min) stats->min = cycles;
+  if (cycles > stats->max) stats->max = cycles;
+  stats->total += cycles;
+  stats->samples++;
+}
+
+
+/**************************************************************************************************/
+uint32_t dwtStatsAverage(const volatile DwtStats *stats) {
+  return (stats->samples != 0) ? (uint32_t)(stats->total / stats->samples) : 0;
+}
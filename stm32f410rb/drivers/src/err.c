@@ -38,6 +38,7 @@
 #include <stdint.h>
 #include "stm32f410rb.h"
 #include "err.h"
+#include "bitband.h"
 
 __attribute__((section(".err"))) uint16_t errnum = 0;
 __attribute__((section(".err"))) uint16_t errcode = 0;
@@ -65,7 +66,7 @@ void triggerError(uint16_t number, uint16_t code) {
 
   // Initialize GPIOA if not already initialized
   if (!(RCC->AHB1ENR & (1 << 0))) {
-    RCC->AHB1ENR |= (1 << 0);
+    BITBAND_PERIPH(RCC->AHB1ENR, 0) = 1;
     for (uint32_t i = 0; i < 10000; i++);
   }
   
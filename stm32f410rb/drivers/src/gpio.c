@@ -34,6 +34,10 @@
 #include "stm32f410rb.h"
 #include "gpio.h"
 #include "err.h"
+#include "atomic.h"
+#include "bitband.h"
+#include "nvic.h"
+#include "clk.h"
 
 
 /***************************************************************************************************
@@ -43,16 +47,39 @@ static void (*gpio_isr_functions[16])(void);
 
 
 /***************************************************************************************************
- * @brief       Provides a delay function.
+ * @brief       Ports whose clock is referenced by the driver, bit n being kClkGpioA + n
+ */
+static uint32_t gpio_port_refs;
+
+
+/***************************************************************************************************
+ * @brief       Whether the driver holds a reference on the SYSCFG clock, needed for EXTICR
+ */
+static uint8_t gpio_syscfg_ref;
+
+
+/***************************************************************************************************
+ * @brief       Gets the clock of a GPIO port.
  *
- * @details     This function introduces a delay by executing an empty loop for a fixed number 
- *              of iterations.
- * 
- * @todo        Make use of the RTC to provide a more accurate delay funciton
- * @todo        Make the function usable in a util.c file
+ * @param       port  The GPIO port.
+ * @param       clk   Where the clock of the port is stored.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
  */
-static inline void delay() {
-  for (volatile uint32_t delay = 0; delay < 100000; ++delay) {}
+static int gpioPortClock(GPIO_Type *port, ClkPeripheral *clk) {
+  if (port == GPIOA)
+    *clk = kClkGpioA;
+  else if (port == GPIOB)
+    *clk = kClkGpioB;
+  else if (port == GPIOC)
+    *clk = kClkGpioC;
+  else if (port == GPIOH)
+    *clk = kClkGpioH;
+  else {
+    triggerError(1, 1); // Wrong GPIO port
+    return 1;
+  }
+  return 0;
 }
 
 
@@ -141,8 +168,8 @@ static inline int checkGpioPinModeOutput(GPIO_Type *port, uint8_t pin) {
 /***************************************************************************************************
  * @details     This function configures the mode of a GPIO pin on the STM32F10RB microcontroller.
  *              The pin number should be within the range 0-15. 
- *              The GPIO port is checked for initialization, and if not initialized, it is enabled. 
- *              The pin mode is then set according to the provided mode.
+ *              The first time a pin of the port is set up, the driver takes a reference on the
+ *              clock of the port (see clk.h). The pin mode is then set according to the provided mode.
  *              The mode parameter should be one of the values from the GpioMode enumeration.
  *              Upon successful configuration, the function returns 0. Otherwise, 1 is returned and
  *              variables errnum and errcode are set with the error code.
@@ -152,37 +179,22 @@ static inline int checkGpioPinModeOutput(GPIO_Type *port, uint8_t pin) {
 int gpioPinSetup(GPIO_Type *port, uint8_t pin, GpioMode mode) {
   if (checkGpioValidPin(pin)) return 1; // Given pin is not in range 0..15
 
-  // Check if port is initializated, if not, initialize it
-  if (port == GPIOA) {
-    if (!(RCC->AHB1ENR & (1 << 0))) {
-      RCC->AHB1ENR |= (1 << 0);
-      delay();
-    }
-  } else if (port == GPIOB) {
-    if (!(RCC->AHB1ENR & (1 << 1))) {
-      RCC->AHB1ENR |= (1 << 1);
-      delay();
-    } 
-  }
-  else if (port == GPIOC) {
-    if (!(RCC->AHB1ENR & (1 << 2))) {
-      RCC->AHB1ENR |= (1 << 2);
-      delay();
-    }
-  }
-  else if (port == GPIOH) {
-    if (!(RCC->AHB1ENR & (1 << 7))) {
-      RCC->AHB1ENR |= (1 << 7);
-      delay();
+  ClkPeripheral clk;
+  if (gpioPortClock(port, &clk)) return 1; // Wrong GPIO port
+
+  // The driver takes one reference on the port clock, on the first setup of any of its pins
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  if (!(gpio_port_refs & (1 << clk))) {
+    if (clkEnable(clk)) {
+      criticalExit(basepri);
+      return 1;
     }
-  }
-  else {
-    triggerError(1, 1); // Wrong GPIO port
-    return 1;
+    gpio_port_refs |= (1 << clk);
   }
 
   port->MODER &= ~(3 << pin * 2); // Reset mode before overwritting with new one
   port->MODER |= (mode << pin * 2);
+  criticalExit(basepri);
 
   return 0;
 }
@@ -202,8 +214,10 @@ int gpioPinPullTypeSetup(GPIO_Type *port, uint8_t pin, GpioPullType pull_type) {
   if (checkGpioPortInit(port)) return 1; // Uninitialized port
   if (checkGpioValidPin(pin)) return 1; // Given pin is not in range 0..15
   
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
   port->PUPDR &= ~(3 << pin * 2);
   port->PUPDR |= (pull_type << pin * 2);
+  criticalExit(basepri);
   return 0;
 }
 
@@ -251,9 +265,9 @@ int gpioPinWrite(GPIO_Type *port, uint8_t pin, uint8_t value, uint8_t *old_value
   *old_value = (uint8_t) pin_value;
 
   if (value == 0) {
-    port->ODR &= ~(1 << pin);
+    port->BSRR = (1 << (pin + 16));   // Reset pin, no read-modify-write of ODR needed
   } else if (value == 1) {
-    port->ODR |= (1 << pin);
+    port->BSRR = (1 << pin);          // Set pin
   } else {
     triggerError(1, 5); // Tried to write wrong value
     return 1;
@@ -283,7 +297,9 @@ int gpioPinToggle(GPIO_Type *port, uint8_t pin, uint8_t *old_value) {
   uint32_t pin_value = (port->IDR >> pin) & 0x01;
   *old_value = (uint8_t) pin_value;
 
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
   port->ODR ^= (1 << pin);
+  criticalExit(basepri);
   return 0;
 }
 
@@ -331,34 +347,35 @@ int gpioInterruptSet(GPIO_Type *port, uint8_t pin, uint8_t rising_edge, uint8_t
     return 1;
   }
 
-  RCC->APB2ENR |= (1 << 14);    // Enable system configuration controller clock
-  SYSCFG->EXTICR[pin / 4] &= ~(0xF << (pin % 4) * 4); // Clear register
-  SYSCFG->EXTICR[pin / 4] |= (exti_source_input << (pin % 4) * 4);  // Select source input for EXTIx
-  
-  EXTI->IMR |= (1 << pin);  // Set pin in EXTI line as interrupt
-  if (rising_edge == 1) {
-    EXTI->RTSR |= (1 << pin); // Enable rising edge trigger
-    EXTI->FTSR &= ~(1 << pin);  // Disable falling edge trigger
-  } else {
-    EXTI->RTSR &= ~(1 << pin);  // Disable rising edge trigger
-    EXTI->FTSR |= (1 << pin); // Enable falling edge trigger
-  }
+  gpio_isr_functions[pin] = handler;   // Stored before the line can trigger
 
-  // Set priority and set-enable interrupt
-  if (pin <= 4) {
-    NVIC->IPR[6 + pin] = (priority << 4);
-    NVIC->ISER[0] |= (1 << (6 + pin));
-  } else if (pin <= 9) {
-    NVIC->IPR[23] = (priority << 4);
-    NVIC->ISER[0] |= (1 << 23);
-  } else {
-    NVIC->IPR[40] = (priority << 4);
-    NVIC->ISER[1] |= (1 << 8);
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  if (!gpio_syscfg_ref) {
+    if (clkEnable(kClkSyscfg)) {  // System configuration controller clock, kept for EXTICR
+      criticalExit(basepri);
+      return 1;
+    }
+    gpio_syscfg_ref = 1;
   }
-
-  gpio_isr_functions[pin] = handler;
-
-  return 0;
+  SYSCFG->EXTICR[pin / 4] &= ~(0xF << (pin % 4) * 4); // Clear register
+  SYSCFG->EXTICR[pin / 4] |= (exti_source_input << (pin % 4) * 4);  // Select source input for EXTIx
+  criticalExit(basepri);
+
+  // Single bits of the EXTI registers, written through their bit-band alias
+  BITBAND_PERIPH(EXTI->RTSR, pin) = (rising_edge == 1);   // Rising edge trigger
+  BITBAND_PERIPH(EXTI->FTSR, pin) = (rising_edge != 1);   // Falling edge trigger
+  BITBAND_PERIPH(EXTI->IMR, pin) = 1;                     // Set pin in EXTI line as interrupt
+
+  NvicIrq irq;
+  if (pin <= 4)
+    irq = kIrqExti0 + pin;
+  else if (pin <= 9)
+    irq = kIrqExti9_5;
+  else
+    irq = kIrqExti15_10;
+
+  if (nvicSetPriority(irq, priority)) return 1;
+  return nvicEnable(irq);
 }
 
 
@@ -373,7 +390,7 @@ int gpioInterruptSet(GPIO_Type *port, uint8_t pin, uint8_t rising_edge, uint8_t
 void EXTI0_ISR (void) {
   if (EXTI->PR & (1 << 0)) {
     gpio_isr_functions[0]();
-    EXTI->PR |= (1 << 0);    // Clear flag
+    EXTI->PR = (1 << 0);    // Clear flag
   }
 }
 
@@ -389,7 +406,7 @@ void EXTI0_ISR (void) {
 void EXTI1_ISR (void) {
   if (EXTI->PR & (1 << 1)) {
     gpio_isr_functions[1]();
-    EXTI->PR |= (1 << 1);    // Clear flag
+    EXTI->PR = (1 << 1);    // Clear flag
   }
 }
 
@@ -405,7 +422,7 @@ void EXTI1_ISR (void) {
 void EXTI2_ISR (void) {
   if (EXTI->PR & (1 << 2)) {
     gpio_isr_functions[2]();
-    EXTI->PR |= (1 << 2);    // Clear flag
+    EXTI->PR = (1 << 2);    // Clear flag
   }
 }
 
@@ -421,7 +438,7 @@ void EXTI2_ISR (void) {
 void EXTI3_ISR (void) {
   if (EXTI->PR & (1 << 3)) {
     gpio_isr_functions[3]();
-    EXTI->PR |= (1 << 3);    // Clear flag
+    EXTI->PR = (1 << 3);    // Clear flag
   }
 }
 
@@ -437,7 +454,7 @@ void EXTI3_ISR (void) {
 void EXTI4_ISR (void) {
   if (EXTI->PR & (1 << 4)) {
     gpio_isr_functions[4]();
-    EXTI->PR |= (1 << 4);    // Clear flag
+    EXTI->PR = (1 << 4);    // Clear flag
   }
 }
 
@@ -455,7 +472,7 @@ void EXTI9_5_ISR (void) {
   for (int i = 5; i <= 9; i++) {
     if (EXTI->PR & (1 << i)) {
       gpio_isr_functions[i]();
-      EXTI->PR |= (1 << i);
+      EXTI->PR = (1 << i);
     }
   }
 }
@@ -474,7 +491,25 @@ void EXTI15_10_ISR (void) {
   for (int i = 10; i <= 15; i++) {
     if (EXTI->PR & (1 << i)) {
       gpio_isr_functions[i]();
-      EXTI->PR |= (1 << i);
+      EXTI->PR = (1 << i);
     }
   }
-}
\ No newline at end of file
+}
+
+
+/***************************************************************************************************
+ * @details     The pins keep their mode and output level while the clock is off, but they can no
+ *              longer be read or changed until one of them is set up again.
+ */
+int gpioPortRelease(GPIO_Type *port) {
+  ClkPeripheral clk;
+  if (gpioPortClock(port, &clk)) return 1; // Wrong GPIO port
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  if (gpio_port_refs & (1 << clk)) {
+    gpio_port_refs &= ~(1 << clk);
+    clkRelease(clk);
+  }
+  criticalExit(basepri);
+  return 0;
+}
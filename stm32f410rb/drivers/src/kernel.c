@@ -0,0 +1,318 @@
+/***************************************************************************************************
+ * @file        kernel.c
+ *
+ * @brief       Source file for the preemptive kernel.
+ *
+ * @details     This file implements the thread table, the stack pool, the scheduler and the SysTick
+ *              and PendSV handlers. The scheduler state is only modified from the SysTick handler
+ *              or by threads inside a critical section. SysTick and PendSV share the lowest priority
+ *              so they never preempt each other.
+ *
+ *              The saved context of a thread, from the lowest address, is: R4-R11 and EXC_RETURN
+ *              (pushed by PendSV_ISR), S16-S31 (only if bit 4 of EXC_RETURN is clear) and the
+ *              exception frame pushed by the hardware.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "kernel.h"
+#include "err.h"
+#include "atomic.h"
+#include "nvic.h"
+#include "lpm.h"
+
+
+#define KERNEL_CONTEXT_WORDS    (17U)       // R4-R11, EXC_RETURN and the 8-word exception frame
+#define KERNEL_EXC_RETURN       (0xFFFFFFFDUL)  // Thread mode, PSP, no FPU frame
+
+#ifdef __ARM_FP
+#define KERNEL_SAVE_FP          "tst lr, #0x10\n" "it eq\n" "vstmdbeq r0!, {s16-s31}\n"
+#define KERNEL_RESTORE_FP       "tst lr, #0x10\n" "it eq\n" "vldmiaeq r0!, {s16-s31}\n"
+#else
+#define KERNEL_SAVE_FP          ""
+#define KERNEL_RESTORE_FP       ""
+#endif
+
+
+/***************************************************************************************************
+ * @brief       Thread states.
+ */
+typedef enum {
+  kThreadFree = 0,
+  kThreadReady,
+  kThreadSleeping,
+  kThreadDone
+} KernelThreadState;
+
+
+/***************************************************************************************************
+ * @brief       Thread control block.
+ */
+typedef struct {
+  uint32_t *sp;                           // Saved stack pointer, must be first (see PendSV_ISR)
+  uint32_t wake;                          // Tick at which a sleeping thread becomes ready
+  uint8_t priority;
+  uint8_t state;
+} KernelTcb;
+
+
+static KernelTcb kernel_threads[KERNEL_MAX_THREADS];
+static uint64_t kernel_stack_pool[KERNEL_STACK_POOL_SIZE / 8];   // 8-byte aligned stacks
+static uint32_t kernel_stack_used;
+static volatile uint32_t kernel_ticks;
+static uint8_t kernel_started;
+
+// Context of the code that called kernelStart(), saved once and never restored
+static KernelTcb kernel_boot;
+static uint32_t kernel_boot_stack[32];
+
+static KernelTcb *volatile kernel_current __attribute__((used));
+static KernelTcb *volatile kernel_next __attribute__((used));
+
+
+/***************************************************************************************************
+ * @brief       Selects the highest priority ready thread and pends PendSV if it is not the running
+ *              one. The search starts after the running thread, so threads with the same priority
+ *              are taken in turns. Must be called inside a critical section or from SysTick.
+ */
+static void kernelSchedule(void) {
+  uint32_t start = 0;
+  KernelTcb *next = NULL;
+
+  if (kernel_current != &kernel_boot) start = (kernel_current - kernel_threads) + 1;
+
+  for (uint32_t i = 0; i < KERNEL_MAX_THREADS; i++) {
+    KernelTcb *tcb = &kernel_threads[(start + i) % KERNEL_MAX_THREADS];
+    if (tcb->state != kThreadReady) continue;
+    if (next == NULL || tcb->priority < next->priority) next = tcb;
+  }
+
+  kernel_next = next;   // Never NULL, the idle thread is always ready
+  if (next != kernel_current) SCB->ICSR = (1 << 28);    // PENDSVSET
+}
+
+
+/***************************************************************************************************
+ * @brief       Terminates the running thread. Thread entry functions return here.
+ *
+ * @details     The stack of the thread is not given back to the pool.
+ */
+static void kernelThreadExit(void) {
+  criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  kernel_current->state = kThreadDone;
+  kernelSchedule();
+  criticalExit(0);      // PendSV switches away and never comes back
+
+  while (1);
+}
+
+
+/***************************************************************************************************
+ * @brief       Idle thread. It only runs when no other thread is ready, and any interrupt that
+ *              readies one also pends PendSV, which wakes lpmIdle() up.
+ */
+static void kernelIdle(void *arg) {
+  (void)arg;
+
+  while (1) {
+    uint32_t primask = criticalEnterAll();
+    lpmIdle();
+    criticalExitAll(primask);
+  }
+}
+
+
+/***************************************************************************************************
+ * @brief       Allocates a stack and builds the initial context of a thread, so that the first
+ *              switch to it "returns" into its entry function.
+ */
+static int kernelCreate(KernelThread entry, void *arg, uint8_t priority, uint32_t stack_size) {
+  KernelTcb *tcb = NULL;
+  stack_size = (stack_size + 7) & ~7UL;
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+
+  for (uint32_t i = 0; i < KERNEL_MAX_THREADS; i++) {
+    if (kernel_threads[i].state == kThreadFree) {
+      tcb = &kernel_threads[i];
+      break;
+    }
+  }
+  if (tcb == NULL || stack_size < 4 * KERNEL_CONTEXT_WORDS ||
+      stack_size > KERNEL_STACK_POOL_SIZE - kernel_stack_used) {
+    criticalExit(basepri);
+    triggerError(5, 1); // No free thread slot or not enough stack
+    return 1;
+  }
+
+  uint32_t *sp = (uint32_t*)((uint8_t*)kernel_stack_pool + kernel_stack_used + stack_size);
+  kernel_stack_used += stack_size;
+
+  *--sp = 0x01000000;                     // xPSR (Thumb bit)
+  *--sp = (uint32_t)entry & ~1UL;         // PC
+  *--sp = (uint32_t)kernelThreadExit;     // LR
+  for (uint32_t i = 0; i < 4; i++) {
+    *--sp = 0;                            // R12, R3, R2, R1
+  }
+  *--sp = (uint32_t)arg;                  // R0
+  *--sp = KERNEL_EXC_RETURN;              // LR of PendSV_ISR
+  for (uint32_t i = 0; i < 8; i++) {
+    *--sp = 0;                            // R11 - R4
+  }
+
+  tcb->sp = sp;
+  tcb->priority = priority;
+  tcb->state = kThreadReady;
+  if (kernel_started) kernelSchedule();
+
+  criticalExit(basepri);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+int kernelThreadCreate(KernelThread entry, void *arg, uint8_t priority, uint32_t stack_size) {
+  if (entry == NULL || priority >= KERNEL_PRIORITIES) {
+    triggerError(5, 2); // Wrong thread priority or null entry function
+    return 1;
+  }
+
+  return kernelCreate(entry, arg, priority, stack_size);
+}
+
+
+/***************************************************************************************************
+ * @details     PSP is pointed at a scratch buffer before the first PendSV, which saves the context
+ *              of the caller there and then loads the first thread.
+ */
+int kernelStart(uint32_t core_clk_hz, uint32_t tick_hz) {
+  if (tick_hz == 0 || core_clk_hz / tick_hz == 0 || core_clk_hz / tick_hz > (1UL << 24)) {
+    triggerError(5, 3); // Wrong tick rate (reload value must fit in 24 bits)
+    return 1;
+  }
+  if (kernelCreate(kernelIdle, NULL, KERNEL_PRIORITIES, KERNEL_IDLE_STACK_SIZE)) return 1;
+
+  lpmStopLock();        // The tick never stops, so the idle thread only enters Sleep mode
+
+  criticalEnter(CRITICAL_DRIVER_PRIORITY);
+
+  nvicSetPriority(kIrqPendSV, 15);        // Lowest priority
+  nvicSetPriority(kIrqSysTick, 15);
+
+  kernel_current = &kernel_boot;
+  asm volatile("msr psp, %0" : : "r" (&kernel_boot_stack[32]) : "memory");
+  kernel_started = 1;
+  kernelSchedule();
+
+  SYSTICK->LOAD = core_clk_hz / tick_hz - 1;
+  SYSTICK->VAL = 0;
+  SYSTICK->CTRL = (1 << 2) | (1 << 1) | (1 << 0);   // Core clock, interrupt, enable
+
+  criticalExit(0);      // PendSV switches to the first thread
+
+  while (1);
+}
+
+
+/**************************************************************************************************/
+void kernelYield(void) {
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  kernelSchedule();
+  criticalExit(basepri);
+}
+
+
+/**************************************************************************************************/
+void kernelSleep(uint32_t ticks) {
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+
+  if (ticks > 0) {
+    kernel_current->wake = kernel_ticks + ticks;
+    kernel_current->state = kThreadSleeping;
+  }
+  kernelSchedule();
+
+  criticalExit(basepri);
+}
+
+
+/**************************************************************************************************/
+uint32_t kernelTicks(void) {
+  return kernel_ticks;
+}
+
+
+/**************************************************************************************************/
+__attribute__((weak)) void kernelTickHook(void) {
+}
+
+
+/***************************************************************************************************
+ * @details     Wakes the threads whose sleep has expired and starts a new time slice.
+ */
+void Systick_ISR(void) {
+  kernel_ticks++;
+
+  for (uint32_t i = 0; i < KERNEL_MAX_THREADS; i++) {
+    KernelTcb *tcb = &kernel_threads[i];
+    if (tcb->state == kThreadSleeping && (int32_t)(kernel_ticks - tcb->wake) >= 0) {
+      tcb->state = kThreadReady;
+    }
+  }
+  kernelSchedule();
+
+  kernelTickHook();
+}
+
+
+/***************************************************************************************************
+ * @details     Saves the context of kernel_current on its stack and restores the one of
+ *              kernel_next. S16-S31 are only saved when bit 4 of EXC_RETURN is clear, i.e. when
+ *              the thread has an active FPU context; reading them also triggers the lazy
+ *              stacking of S0-S15 that the hardware reserved space for on exception entry.
+ */
+void __attribute__((naked)) PendSV_ISR(void) {
+  asm volatile(
+    "cpsid i\n"
+    "mrs r0, psp\n"
+    KERNEL_SAVE_FP
+    "stmdb r0!, {r4-r11, lr}\n"
+    "movw r1, #:lower16:kernel_current\n"
+    "movt r1, #:upper16:kernel_current\n"
+    "ldr r2, [r1]\n"
+    "str r0, [r2]\n"                      // kernel_current->sp = r0
+    "movw r2, #:lower16:kernel_next\n"
+    "movt r2, #:upper16:kernel_next\n"
+    "ldr r2, [r2]\n"
+    "str r2, [r1]\n"                      // kernel_current = kernel_next
+    "ldr r0, [r2]\n"
+    "ldmia r0!, {r4-r11, lr}\n"
+    KERNEL_RESTORE_FP
+    "msr psp, r0\n"
+    "isb\n"
+    "cpsie i\n"
+    "bx lr\n"
+  );
+}
@@ -0,0 +1,182 @@
+/***************************************************************************************************
+ * @file        log.c
+ *
+ * @brief       Source file for the tokenized deferred logger.
+ *
+ * @details     This file implements the RAM ring of the logger and the interrupt-driven USART
+ *              drain. Messages are reserved and written as a whole inside a critical section,
+ *              which keeps a message contiguous when the main loop and an interrupt handler log at the
+ *              same time. The critical section only copies at most LOG_MAX_ARGS + 1 words.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "log.h"
+#include "err.h"
+#include "atomic.h"
+#include "bitband.h"
+#include "nvic.h"
+#include "lpm.h"
+
+
+static volatile uint32_t log_ring[LOG_RING_WORDS];
+static volatile uint32_t log_head;      // Next word to write (free-running)
+static volatile uint32_t log_tail;      // Word being sent (free-running)
+static volatile uint32_t log_byte;      // Next byte of the word being sent (0 - 3)
+static USART_Type *log_usart;
+static uint8_t log_locked;              // Stop mode locked until the last byte is shifted out
+
+volatile uint32_t log_dropped;
+
+
+/***************************************************************************************************
+ * @brief       Writes the next byte of the ring to the USART or, when the ring is empty, swaps the
+ *              TXE interrupt for the TC one. Must be called inside a critical section and with TXE
+ *              set.
+ */
+static void logSendNext(void) {
+  if (log_tail == log_head) {
+    BITBAND_PERIPH(log_usart->CR1, 7) = 0;    // TXEIE = 0: nothing left to send
+    BITBAND_PERIPH(log_usart->CR1, 6) = 1;    // TCIE = 1: wait for the last byte to go out
+    return;
+  }
+
+  log_usart->DR = (log_ring[log_tail & (LOG_RING_WORDS - 1)] >> (8 * log_byte)) & 0xFF;
+  if (++log_byte == 4) {
+    log_byte = 0;
+    log_tail++;
+  }
+}
+
+
+/***************************************************************************************************
+ * @details     The priority is checked here, so the NVIC calls that use it cannot fail.
+ */
+int logInit(USART_Type *usart, uint8_t priority) {
+  NvicIrq irq;
+
+  if (usart == USART1)
+    irq = kIrqUsart1;
+  else if (usart == USART2)
+    irq = kIrqUsart2;
+  else if (usart == USART6)
+    irq = kIrqUsart6;
+  else {
+    triggerError(3, 1); // Wrong USART
+    return 1;
+  }
+  if (priority < CRITICAL_DRIVER_PRIORITY || priority > 15) {
+    triggerError(3, 2); // Wrong interrupt priority
+    return 1;
+  }
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  log_usart = usart;
+  log_head = 0;
+  log_tail = 0;
+  log_byte = 0;
+  log_dropped = 0;
+  criticalExit(basepri);
+
+  nvicSetPriority(irq, priority);
+  nvicEnable(irq);
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     The header word carries the 0xA0 sync nibble and the number of arguments in its top
+ *              byte, so the host can resynchronize after a lost byte.
+ */
+void logWrite(uint32_t token, uint32_t nargs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+  if (nargs > LOG_MAX_ARGS) nargs = LOG_MAX_ARGS;
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+
+  if (log_usart == NULL || LOG_RING_WORDS - (log_head - log_tail) < nargs + 1) {
+    log_dropped++;
+    criticalExit(basepri);
+    return;
+  }
+
+  uint32_t head = log_head;
+  log_ring[head++ & (LOG_RING_WORDS - 1)] = ((0xA0 | nargs) << 24) | (token & 0x00FFFFFF);
+  if (nargs > 0) log_ring[head++ & (LOG_RING_WORDS - 1)] = a0;
+  if (nargs > 1) log_ring[head++ & (LOG_RING_WORDS - 1)] = a1;
+  if (nargs > 2) log_ring[head++ & (LOG_RING_WORDS - 1)] = a2;
+  if (nargs > 3) log_ring[head++ & (LOG_RING_WORDS - 1)] = a3;
+  log_head = head;
+
+  if (!log_locked) {
+    lpmStopLock();                          // The USART stops in Stop mode
+    log_locked = 1;
+  }
+  BITBAND_PERIPH(log_usart->CR1, 6) = 0;   // TCIE = 0: more bytes to send
+  BITBAND_PERIPH(log_usart->CR1, 7) = 1;   // TXEIE = 1: start draining
+  criticalExit(basepri);
+}
+
+
+/***************************************************************************************************
+ * @details     The Stop mode lock is released on TC, once the last byte has been shifted out.
+ */
+void logUsartIsr(void) {
+  if (log_usart == NULL) return;
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  uint32_t sr = log_usart->SR;
+  uint32_t cr1 = log_usart->CR1;
+
+  if ((cr1 & (1 << 7)) && (sr & (1 << 7))) {
+    logSendNext();
+  }
+  else if ((cr1 & (1 << 6)) && (sr & (1 << 6))) {
+    BITBAND_PERIPH(log_usart->CR1, 6) = 0;  // TCIE = 0
+    if (log_locked) {
+      log_locked = 0;
+      lpmStopUnlock();
+    }
+  }
+  criticalExit(basepri);
+}
+
+
+/***************************************************************************************************
+ * @details     Sends by polling TXE, so it also works with interrupts disabled (e.g. before
+ *              triggerError() or before entering a low-power mode).
+ */
+void logFlush(void) {
+  if (log_usart == NULL) return;
+
+  while (log_tail != log_head) {
+    while (!(log_usart->SR & (1 << 7)));    // Wait for TXE
+
+    // The interrupt may have taken this TXE before the critical section, so check it again
+    uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+    if (log_usart->SR & (1 << 7)) logSendNext();
+    criticalExit(basepri);
+  }
+  while (!(log_usart->SR & (1 << 6)));      // Wait for TC (last byte shifted out)
+}
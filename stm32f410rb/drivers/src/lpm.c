@@ -0,0 +1,264 @@
+/***************************************************************************************************
+ * @file        lpm.c
+ *
+ * @brief       Source file for the low power idle framework.
+ *
+ * @details     This file implements the entry to Sleep and Stop modes, the restoration of the
+ *              system clock after Stop mode and the statistics of the power states.
+ *
+ *              Stop mode is entered with WFI while SLEEPDEEP is set in SCB->SCR and PDDS is clear
+ *              in PWR->CR. On wakeup the oscillators and the PLL are off and HSI is the system
+ *              clock, but the configuration in RCC->PLLCFGR, the prescalers in RCC->CFGR and the
+ *              flash wait states are kept, so turning the sources back on and switching to the
+ *              saved clock is enough.
+ *
+ *              In lpmSleepOnExit() no code runs around the WFI, so the time is split afterwards:
+ *              DWT->CYCCNT only counts while the core runs, and whatever the statistics clock
+ *              counted on top of it was spent sleeping.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "lpm.h"
+#include "err.h"
+#include "atomic.h"
+#include "bitband.h"
+#include "clk.h"
+#include "dwt.h"
+#include "perf.h"
+
+
+#define SCR_SLEEPONEXIT     (1UL << 1)
+#define SCR_SLEEPDEEP       (1UL << 2)
+
+#define PWR_CR_LPDS         (0U)        // Low power regulator in Stop mode
+#define PWR_CR_FPDS         (9U)        // Flash power-down in Stop mode
+
+#define RCC_CR_HSEON        (1UL << 16)
+#define RCC_CR_HSERDY       (1UL << 17)
+#define RCC_CR_PLLON        (1UL << 24)
+#define RCC_CR_PLLRDY       (1UL << 25)
+#define RCC_CFGR_SW_MASK    (3UL)       // 0: HSI, 1: HSE, 2: PLL P, 3: PLL R
+#define RCC_CFGR_SWS_POS    (2U)
+
+
+static LpmClock lpm_clock;
+static uint32_t lpm_clock_hz;
+static uint32_t lpm_last;               // Clock reading at the end of the last update
+static LpmState lpm_exit_state;         // State entered on exit, kLpmRun before lpmSleepOnExit()
+static uint8_t lpm_exit_stop;           // lpmSleepOnExit(kLpmStop) was called
+static uint32_t lpm_exit_cycles;        // DWT->CYCCNT at the last update in lpmSleepOnExit()
+static uint8_t lpm_initialized;
+static volatile uint32_t lpm_stop_locks;
+static LpmStats lpm_stats;
+
+
+/***************************************************************************************************
+ * @brief       Reads the statistics clock, 0 if there is none.
+ */
+static uint32_t lpmNow(void) {
+  return (lpm_clock != NULL) ? lpm_clock() : 0;
+}
+
+
+/***************************************************************************************************
+ * @brief       Splits the time since the last update between kLpmRun and the state entered on exit.
+ *              Must be called with every interrupt masked.
+ */
+static void lpmUpdateExit(void) {
+  uint32_t now = lpmNow();
+  uint32_t cycles = dwtCycles();
+  uint32_t elapsed = now - lpm_last;
+  uint32_t run = (uint32_t)((uint64_t)(cycles - lpm_exit_cycles) * lpm_clock_hz / perfHclkHz());
+
+  if (run > elapsed) run = elapsed;     // Both clocks are read a few cycles apart
+  lpm_stats.time[kLpmRun] += run;
+  lpm_stats.time[lpm_exit_state] += elapsed - run;
+  lpm_last = now;
+  lpm_exit_cycles = cycles;
+}
+
+
+/***************************************************************************************************
+ * @brief       Changes the state entered on exit after lpmSleepOnExit(kLpmStop), when the first
+ *              lock is taken or the last one released. Must be called with every interrupt masked.
+ */
+static void lpmSetExitState(LpmState state) {
+  if (lpm_clock != NULL) lpmUpdateExit();
+  lpm_exit_state = state;
+
+  if (state == kLpmStop)
+    SCB->SCR |= SCR_SLEEPDEEP;
+  else
+    SCB->SCR &= ~SCR_SLEEPDEEP;
+}
+
+
+/***************************************************************************************************
+ * @brief       Turns back on the clock sources that were on before Stop mode and switches the
+ *              system clock back to the one that was selected.
+ *
+ * @param       cr        RCC->CR before Stop mode.
+ * @param       cfgr      RCC->CFGR before Stop mode.
+ */
+static void lpmRestoreClock(uint32_t cr, uint32_t cfgr) {
+  uint32_t sw = cfgr & RCC_CFGR_SW_MASK;
+
+  if (sw == 0) return;    // Still running on HSI
+
+  if (cr & RCC_CR_HSEON) {
+    RCC->CR |= RCC_CR_HSEON;
+    while (!(RCC->CR & RCC_CR_HSERDY)) {}
+  }
+  if (cr & RCC_CR_PLLON) {
+    RCC->CR |= RCC_CR_PLLON;
+    while (!(RCC->CR & RCC_CR_PLLRDY)) {}
+  }
+
+  RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW_MASK) | sw;
+  while (((RCC->CFGR >> RCC_CFGR_SWS_POS) & RCC_CFGR_SW_MASK) != sw) {}
+}
+
+
+/**************************************************************************************************/
+void lpmInit(LpmClock clock, uint32_t clock_hz) {
+  clkEnable(kClkPwr);
+  BITBAND_PERIPH(PWR->CR, PWR_CR_LPDS) = 1;
+  BITBAND_PERIPH(PWR->CR, PWR_CR_FPDS) = 1;
+
+  uint32_t primask = criticalEnterAll();
+  lpm_clock = clock;
+  lpm_clock_hz = clock_hz;
+  lpm_exit_state = kLpmRun;
+  for (uint32_t i = 0; i < kLpmStates; i++) {
+    lpm_stats.time[i] = 0;
+    lpm_stats.entries[i] = 0;
+  }
+  lpm_last = lpmNow();
+  lpm_initialized = 1;
+  criticalExitAll(primask);
+}
+
+
+/***************************************************************************************************
+ * @details     RCC->CR and RCC->CFGR are saved right before Stop mode. The flags are cleared in
+ *              SCB->SCR again before anything else, so a later WFI (e.g. in the idle thread of the
+ *              kernel) only enters Sleep mode.
+ */
+void lpmIdle(void) {
+  LpmState state = (lpm_initialized && lpm_stop_locks == 0) ? kLpmStop : kLpmSleep;
+  uint32_t start = lpmNow();
+
+  lpm_stats.time[kLpmRun] += start - lpm_last;
+  lpm_stats.entries[state]++;
+
+  if (state == kLpmStop) {
+    uint32_t cr = RCC->CR;
+    uint32_t cfgr = RCC->CFGR;
+
+    SCB->SCR |= SCR_SLEEPDEEP;
+    asm volatile("dsb\n" "wfi\n" "isb\n" : : : "memory");
+    SCB->SCR &= ~SCR_SLEEPDEEP;
+
+    lpmRestoreClock(cr, cfgr);
+  }
+  else {
+    asm volatile("dsb\n" "wfi\n" "isb\n" : : : "memory");
+  }
+
+  lpm_last = lpmNow();
+  lpm_stats.time[state] += lpm_last - start;
+}
+
+
+/***************************************************************************************************
+ * @details     From here on the statistics are only brought up to date by lpmGetStats() and by the
+ *              lock changes. With kLpmStop, SLEEPDEEP is only set while no lock is held, and
+ *              lpmStopLock() and lpmStopUnlock() clear and set it again.
+ */
+int lpmSleepOnExit(LpmState state) {
+  if (state != kLpmSleep && state != kLpmStop) {
+    triggerError(10, 1); // Wrong power state
+    return 1;
+  }
+  if (state == kLpmStop && ((RCC->CFGR & RCC_CFGR_SW_MASK) != 0 || !lpm_initialized)) {
+    triggerError(10, 2); // Stop mode needs HSI as system clock and lpmInit()
+    return 1;
+  }
+
+  if (lpm_clock != NULL) dwtInit();
+
+  uint32_t primask = criticalEnterAll();
+  uint32_t now = lpmNow();
+
+  lpm_stats.time[kLpmRun] += now - lpm_last;
+  lpm_stats.entries[state]++;
+  lpm_last = now;
+  lpm_exit_cycles = dwtCycles();
+  lpm_exit_state = (state == kLpmStop && lpm_stop_locks != 0) ? kLpmSleep : state;
+  lpm_exit_stop = (state == kLpmStop);
+  SCB->SCR |= SCR_SLEEPONEXIT | ((lpm_exit_state == kLpmStop) ? SCR_SLEEPDEEP : 0);
+  criticalExitAll(primask);
+
+  while (1) {
+    asm volatile("dsb\n" "wfi\n" : : : "memory");
+  }
+}
+
+
+/***************************************************************************************************
+ * @details     The count and SCB->SCR are changed together with every interrupt masked, so a
+ *              handler returning in between cannot enter Stop mode with a lock held.
+ */
+void lpmStopLock(void) {
+  uint32_t primask = criticalEnterAll();
+  if (lpm_stop_locks++ == 0 && lpm_exit_stop) lpmSetExitState(kLpmSleep);
+  criticalExitAll(primask);
+}
+
+
+/**************************************************************************************************/
+int lpmStopUnlock(void) {
+  uint32_t primask = criticalEnterAll();
+
+  if (lpm_stop_locks == 0) {
+    criticalExitAll(primask);
+    triggerError(10, 3); // Unlocked more times than locked
+    return 1;
+  }
+  if (--lpm_stop_locks == 0 && lpm_exit_stop) lpmSetExitState(kLpmStop);
+
+  criticalExitAll(primask);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+void lpmGetStats(LpmStats *stats) {
+  uint32_t primask = criticalEnterAll();
+  if (lpm_exit_state != kLpmRun && lpm_clock != NULL) lpmUpdateExit();
+  *stats = lpm_stats;
+  criticalExitAll(primask);
+}
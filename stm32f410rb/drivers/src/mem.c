@@ -0,0 +1,225 @@
+/***************************************************************************************************
+ * @file        mem.c
+ *
+ * @brief       Source file for the memory block routines.
+ *
+ * @details     This file implements memcpy(), memset() and memmove() as naked functions, following
+ *              the AAPCS: the arguments arrive in r0-r2, r0 is returned, and r4-r10 are saved
+ *              around the block loops that use them. The return value is kept in ip, which is
+ *              free in a leaf function. The C parameters are only there for the prototypes, hence
+ *              the unused attributes.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stddef.h>
+#include "mem.h"
+
+
+#define UNUSED              __attribute__((unused))
+
+
+/***************************************************************************************************
+ * @details     r0: destination, r1: source, r2: bytes left.
+ */
+void * __attribute__((naked)) memcpy(void *restrict dst UNUSED, const void *restrict src UNUSED,
+                                     size_t n UNUSED) {
+  asm volatile(
+    "mov ip, r0\n"
+    "cmp r2, #16\n"
+    "blo .Lcpy_bytes\n"                   // Small block: no setup
+
+  ".Lcpy_align:\n"                        // Align the destination
+    "tst r0, #3\n"
+    "beq .Lcpy_aligned\n"
+    "ldrb r3, [r1], #1\n"
+    "strb r3, [r0], #1\n"
+    "sub r2, r2, #1\n"
+    "b .Lcpy_align\n"
+
+  ".Lcpy_aligned:\n"
+    "tst r1, #3\n"
+    "bne .Lcpy_words\n"                   // LDM needs an aligned source
+    "push {r4-r10}\n"
+    "subs r2, r2, #32\n"
+    "blo .Lcpy_blocks_end\n"
+  ".Lcpy_blocks:\n"
+    "ldmia r1!, {r3-r10}\n"
+    "stmia r0!, {r3-r10}\n"
+    "subs r2, r2, #32\n"
+    "bhs .Lcpy_blocks\n"
+  ".Lcpy_blocks_end:\n"
+    "add r2, r2, #32\n"
+    "pop {r4-r10}\n"
+
+  ".Lcpy_words:\n"
+    "subs r2, r2, #4\n"
+    "blo .Lcpy_words_end\n"
+  ".Lcpy_word_loop:\n"
+    "ldr r3, [r1], #4\n"                  // May be unaligned
+    "str r3, [r0], #4\n"
+    "subs r2, r2, #4\n"
+    "bhs .Lcpy_word_loop\n"
+  ".Lcpy_words_end:\n"
+    "add r2, r2, #4\n"
+
+  ".Lcpy_bytes:\n"
+    "cbz r2, .Lcpy_end\n"
+  ".Lcpy_byte_loop:\n"
+    "ldrb r3, [r1], #1\n"
+    "strb r3, [r0], #1\n"
+    "subs r2, r2, #1\n"
+    "bne .Lcpy_byte_loop\n"
+
+  ".Lcpy_end:\n"
+    "mov r0, ip\n"
+    "bx lr\n"
+  );
+}
+
+
+/***************************************************************************************************
+ * @details     r0: destination, r1: value (replicated to the four bytes of the word), r2: bytes
+ *              left. The block loop stores the same four registers twice.
+ */
+void * __attribute__((naked)) memset(void *dst UNUSED, int c UNUSED, size_t n UNUSED) {
+  asm volatile(
+    "mov ip, r0\n"
+    "uxtb r1, r1\n"
+    "cmp r2, #16\n"
+    "blo .Lset_bytes\n"                   // Small block: no setup
+    "orr r1, r1, r1, lsl #8\n"
+    "orr r1, r1, r1, lsl #16\n"
+
+  ".Lset_align:\n"                        // Align the destination
+    "tst r0, #3\n"
+    "beq .Lset_aligned\n"
+    "strb r1, [r0], #1\n"
+    "sub r2, r2, #1\n"
+    "b .Lset_align\n"
+
+  ".Lset_aligned:\n"
+    "push {r4, r5}\n"
+    "mov r3, r1\n"
+    "mov r4, r1\n"
+    "mov r5, r1\n"
+    "subs r2, r2, #32\n"
+    "blo .Lset_blocks_end\n"
+  ".Lset_blocks:\n"
+    "stmia r0!, {r1, r3-r5}\n"
+    "stmia r0!, {r1, r3-r5}\n"
+    "subs r2, r2, #32\n"
+    "bhs .Lset_blocks\n"
+  ".Lset_blocks_end:\n"
+    "add r2, r2, #32\n"
+    "pop {r4, r5}\n"
+
+    "subs r2, r2, #4\n"
+    "blo .Lset_words_end\n"
+  ".Lset_word_loop:\n"
+    "str r1, [r0], #4\n"
+    "subs r2, r2, #4\n"
+    "bhs .Lset_word_loop\n"
+  ".Lset_words_end:\n"
+    "add r2, r2, #4\n"
+
+  ".Lset_bytes:\n"
+    "cbz r2, .Lset_end\n"
+  ".Lset_byte_loop:\n"
+    "strb r1, [r0], #1\n"
+    "subs r2, r2, #1\n"
+    "bne .Lset_byte_loop\n"
+
+  ".Lset_end:\n"
+    "mov r0, ip\n"
+    "bx lr\n"
+  );
+}
+
+
+/***************************************************************************************************
+ * @details     A forward copy is safe whenever dst is below src, even if the blocks overlap: every
+ *              word is loaded before the store that could overwrite it. Otherwise the copy runs
+ *              backward from the end of both blocks with pre-decrementing loads and stores, r0 and
+ *              r1 pointing one past the bytes left.
+ */
+void * __attribute__((naked)) memmove(void *dst UNUSED, const void *src UNUSED, size_t n UNUSED) {
+  asm volatile(
+    "cmp r0, r1\n"
+    "bls memcpy\n"                        // dst <= src
+    "add r3, r1, r2\n"
+    "cmp r0, r3\n"
+    "bhs memcpy\n"                        // dst >= src + n: no overlap
+
+    "mov ip, r0\n"
+    "add r0, r0, r2\n"
+    "mov r1, r3\n"
+    "cmp r2, #16\n"
+    "blo .Lmove_bytes\n"                  // Small block: no setup
+
+  ".Lmove_align:\n"                       // Align the end of the destination
+    "tst r0, #3\n"
+    "beq .Lmove_aligned\n"
+    "ldrb r3, [r1, #-1]!\n"
+    "strb r3, [r0, #-1]!\n"
+    "sub r2, r2, #1\n"
+    "b .Lmove_align\n"
+
+  ".Lmove_aligned:\n"
+    "tst r1, #3\n"
+    "bne .Lmove_words\n"                  // LDM needs an aligned source
+    "push {r4-r10}\n"
+    "subs r2, r2, #32\n"
+    "blo .Lmove_blocks_end\n"
+  ".Lmove_blocks:\n"
+    "ldmdb r1!, {r3-r10}\n"
+    "stmdb r0!, {r3-r10}\n"
+    "subs r2, r2, #32\n"
+    "bhs .Lmove_blocks\n"
+  ".Lmove_blocks_end:\n"
+    "add r2, r2, #32\n"
+    "pop {r4-r10}\n"
+
+  ".Lmove_words:\n"
+    "subs r2, r2, #4\n"
+    "blo .Lmove_words_end\n"
+  ".Lmove_word_loop:\n"
+    "ldr r3, [r1, #-4]!\n"                // May be unaligned
+    "str r3, [r0, #-4]!\n"
+    "subs r2, r2, #4\n"
+    "bhs .Lmove_word_loop\n"
+  ".Lmove_words_end:\n"
+    "add r2, r2, #4\n"
+
+  ".Lmove_bytes:\n"
+    "cbz r2, .Lmove_end\n"
+  ".Lmove_byte_loop:\n"
+    "ldrb r3, [r1, #-1]!\n"
+    "strb r3, [r0, #-1]!\n"
+    "subs r2, r2, #1\n"
+    "bne .Lmove_byte_loop\n"
+
+  ".Lmove_end:\n"
+    "mov r0, ip\n"
+    "bx lr\n"
+  );
+}
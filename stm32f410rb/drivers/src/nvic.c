@@ -0,0 +1,166 @@
+/***************************************************************************************************
+ * @file        nvic.c
+ *
+ * @brief       Source file for the NVIC driver.
+ *
+ * @details     This file implements the access to the NVIC enable, pending and priority registers
+ *              and to the priority grouping field (PRIGROUP) of the SCB AIRCR register.
+ *
+ *              Priority registers are byte-addressable and only the upper 4 bits are implemented,
+ *              so a priority is written as a whole byte shifted by 4, with no read-modify-write.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+#include "nvic.h"
+#include "err.h"
+
+
+#define AIRCR_VECTKEY       (0x05FAUL << 16)
+#define AIRCR_PRIGROUP_POS  (8U)
+#define AIRCR_PRIGROUP_MASK (7UL << AIRCR_PRIGROUP_POS)
+#define AIRCR_ACTION_MASK   (7UL)       // SYSRESETREQ, VECTCLRACTIVE and VECTRESET, never written 1
+
+
+/***************************************************************************************************
+ * @brief       Checks that irq is a device interrupt, and not a system exception.
+ *
+ * @return      0 if successful, otherwise returns 1 and sets variables errnum and errcode.
+ */
+static int checkNvicIrq(NvicIrq irq) {
+  if (irq < 0 || irq >= (int)NVIC_IRQ_COUNT) {
+    triggerError(7, 1); // Wrong interrupt number
+    return 1;
+  }
+  return 0;
+}
+
+
+/**************************************************************************************************/
+int nvicEnable(NvicIrq irq) {
+  if (checkNvicIrq(irq)) return 1;
+
+  NVIC->ISER[irq / 32] = (1UL << (irq % 32));
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     The barriers make sure the write has reached the NVIC before returning, so the
+ *              caller can then modify the data used by the interrupt handler.
+ */
+int nvicDisable(NvicIrq irq) {
+  if (checkNvicIrq(irq)) return 1;
+
+  NVIC->ICER[irq / 32] = (1UL << (irq % 32));
+  asm volatile("dsb\n" "isb\n" : : : "memory");
+  return 0;
+}
+
+
+/**************************************************************************************************/
+int nvicSetPending(NvicIrq irq) {
+  if (checkNvicIrq(irq)) return 1;
+
+  NVIC->ISPR[irq / 32] = (1UL << (irq % 32));
+  return 0;
+}
+
+
+/**************************************************************************************************/
+int nvicClearPending(NvicIrq irq) {
+  if (checkNvicIrq(irq)) return 1;
+
+  NVIC->ICPR[irq / 32] = (1UL << (irq % 32));
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     System exceptions are mapped to the SHPR bytes: exception number irq + 16 is at
+ *              SHPR[irq + 12]. The bytes of exceptions with a fixed priority are reserved.
+ */
+int nvicSetPriority(NvicIrq irq, uint8_t priority) {
+  if (priority >= (1U << NVIC_PRIORITY_BITS)) {
+    triggerError(7, 2); // Wrong priority
+    return 1;
+  }
+
+  uint8_t value = (uint8_t)(priority << (8 - NVIC_PRIORITY_BITS));
+
+  if (irq >= 0) {
+    if (checkNvicIrq(irq)) return 1;
+    NVIC->IPR[irq] = value;
+  }
+  else if (irq == kIrqMemManage || irq == kIrqBusFault || irq == kIrqUsageFault ||
+           irq == kIrqSVCall || irq == kIrqDebugMonitor || irq == kIrqPendSV ||
+           irq == kIrqSysTick) {
+    SCB->SHPR[irq + 12] = value;
+  }
+  else {
+    triggerError(7, 1); // Wrong interrupt number
+    return 1;
+  }
+
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     PRIGROUP n makes bits [7:n+1] of a priority byte the preemption priority, so for
+ *              the 4 implemented bits it is 7 - preempt_bits. AIRCR is only written together with
+ *              its key, and the reset request bits are always written 0.
+ */
+int nvicSetPriorityGrouping(uint8_t preempt_bits) {
+  if (preempt_bits > NVIC_PRIORITY_BITS) {
+    triggerError(7, 3); // Wrong priority grouping
+    return 1;
+  }
+
+  uint32_t aircr = SCB->AIRCR & ~(0xFFFF0000UL | AIRCR_PRIGROUP_MASK | AIRCR_ACTION_MASK);
+  SCB->AIRCR = AIRCR_VECTKEY | aircr | ((7UL - preempt_bits) << AIRCR_PRIGROUP_POS);
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     PRIGROUP values below 3 leave all the implemented bits as preemption priority.
+ */
+uint8_t nvicGetPriorityGrouping(void) {
+  uint32_t prigroup = (SCB->AIRCR & AIRCR_PRIGROUP_MASK) >> AIRCR_PRIGROUP_POS;
+
+  if (prigroup < 8 - NVIC_PRIORITY_BITS) return NVIC_PRIORITY_BITS;
+  return (uint8_t)(7 - prigroup);
+}
+
+
+/**************************************************************************************************/
+uint8_t nvicEncodePriority(uint8_t preempt, uint8_t sub) {
+  uint8_t preempt_bits = nvicGetPriorityGrouping();
+  uint8_t sub_bits = NVIC_PRIORITY_BITS - preempt_bits;
+
+  preempt &= (1U << preempt_bits) - 1;
+  sub &= (1U << sub_bits) - 1;
+  return (uint8_t)((preempt << sub_bits) | sub);
+}
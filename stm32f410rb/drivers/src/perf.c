@@ -0,0 +1,190 @@
+/***************************************************************************************************
+ * @file        perf.c
+ *
+ * @brief       Source file for the performance profiles.
+ *
+ * @details     This file implements the switch between performance profiles. Whatever the current
+ *              and the new profile are, the switch goes through HSI at 16 MHz, where any number of
+ *              wait states and any voltage scale are valid:
+ *
+ *              1. Select HSI as system clock and turn the PLL off. The voltage scale and the PLL
+ *                 configuration can only be changed while the PLL is off.
+ *              2. Program the wait states of the new profile and read them back, reset the ART
+ *                 caches while they are disabled and enable the accelerator features.
+ *              3. Select the voltage scale and the bus prescalers.
+ *              4. Turn the PLL on, wait for it to lock and for the regulator to reach the new
+ *                 scale (VOSRDY), and only then select it as system clock.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "perf.h"
+#include "err.h"
+#include "atomic.h"
+#include "clk.h"
+
+
+#define HSI_HZ              (16000000UL)
+
+#define RCC_CR_HSION        (1UL << 0)
+#define RCC_CR_HSIRDY       (1UL << 1)
+#define RCC_CR_PLLON        (1UL << 24)
+#define RCC_CR_PLLRDY       (1UL << 25)
+#define RCC_CFGR_SW_MASK    (3UL)
+#define RCC_CFGR_SW_HSI     (0UL)
+#define RCC_CFGR_SW_PLL     (2UL)
+#define RCC_CFGR_SWS_POS    (2U)
+#define RCC_CFGR_PRE_MASK   (0xFFF0UL)  // HPRE, PPRE1 and PPRE2
+#define RCC_CFGR_PPRE1_DIV2 (4UL << 10)
+
+#define PWR_CR_VOS_POS      (14U)
+#define PWR_CR_VOS_MASK     (3UL << PWR_CR_VOS_POS)
+#define PWR_CSR_VOSRDY      (1UL << 14)
+
+#define FLASH_ACR_LATENCY   (0xFUL)
+#define FLASH_ACR_PRFTEN    (1UL << 8)
+#define FLASH_ACR_ICEN      (1UL << 9)
+#define FLASH_ACR_DCEN      (1UL << 10)
+#define FLASH_ACR_ICRST     (1UL << 11)
+#define FLASH_ACR_DCRST     (1UL << 12)
+
+// PLLCFGR from HSI: M in [5:0], N in [14:6], P / 2 - 1 in [17:16], Q in [27:24], R in [30:28]
+#define PLLCFGR(m, n, p, q, r) \
+  ((m) | ((n) << 6) | ((((p) >> 1) - 1) << 16) | ((q) << 24) | ((uint32_t)(r) << 28))
+
+
+/***************************************************************************************************
+ * @brief       Settings of a performance profile.
+ */
+typedef struct {
+  uint32_t hclk_hz;
+  uint32_t pllcfgr;           // 0 to run from HSI with the PLL off
+  uint32_t cfgr_prescalers;   // HPRE, PPRE1 and PPRE2 fields of RCC->CFGR
+  uint32_t acr;               // Wait states and ART accelerator features of FLASH->ACR
+  uint8_t vos;                // VOS field of PWR->CR: 1 scale 3, 2 scale 2, 3 scale 1
+  uint8_t apb1_div;
+} PerfConfig;
+
+
+static const PerfConfig perf_profiles[kPerfProfiles] = {
+  [kPerfMax] = {              // 16 MHz / 8 * 100 / 2
+    100000000UL, PLLCFGR(8, 100, 2, 4, 2), RCC_CFGR_PPRE1_DIV2,
+    3 | FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN, 3, 2
+  },
+  [kPerfBalanced] = {         // 16 MHz / 8 * 128 / 4
+    64000000UL, PLLCFGR(8, 128, 4, 6, 2), RCC_CFGR_PPRE1_DIV2,
+    1 | FLASH_ACR_ICEN | FLASH_ACR_DCEN, 1, 2
+  },
+  [kPerfLowPower] = {
+    HSI_HZ, 0, 0,
+    0 | FLASH_ACR_ICEN | FLASH_ACR_DCEN, 1, 1
+  }
+};
+
+static const PerfConfig *perf_current;    // NULL until the first switch (reset clock: HSI)
+static uint8_t perf_pwr_ref;
+
+
+/***************************************************************************************************
+ * @brief       Selects a system clock source and waits until the switch is done.
+ */
+static void perfSelectClock(uint32_t sw) {
+  RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW_MASK) | sw;
+  while (((RCC->CFGR >> RCC_CFGR_SWS_POS) & RCC_CFGR_SW_MASK) != sw) {}
+}
+
+
+/***************************************************************************************************
+ * @brief       Sets the wait states and the ART accelerator. Must be called while running from HSI.
+ */
+static void perfSetFlash(uint32_t acr) {
+  uint32_t latency = acr & FLASH_ACR_LATENCY;
+
+  FLASH->ACR = latency;                                       // Caches must be off to reset them
+  FLASH->ACR = latency | FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+  FLASH->ACR = latency;
+  FLASH->ACR = acr;
+  while ((FLASH->ACR & FLASH_ACR_LATENCY) != latency) {}     // Must be in effect before speeding up
+}
+
+
+/**************************************************************************************************/
+int perfSetProfile(PerfProfile profile) {
+  if (profile >= kPerfProfiles) {
+    triggerError(11, 1); // Wrong profile
+    return 1;
+  }
+
+  const PerfConfig *config = &perf_profiles[profile];
+
+  if (!perf_pwr_ref) {
+    if (clkEnable(kClkPwr)) return 1;
+    perf_pwr_ref = 1;
+  }
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+
+  RCC->CR |= RCC_CR_HSION;
+  while (!(RCC->CR & RCC_CR_HSIRDY)) {}
+  perfSelectClock(RCC_CFGR_SW_HSI);
+
+  RCC->CR &= ~RCC_CR_PLLON;
+  while (RCC->CR & RCC_CR_PLLRDY) {}
+
+  perfSetFlash(config->acr);
+
+  PWR->CR = (PWR->CR & ~PWR_CR_VOS_MASK) | ((uint32_t)config->vos << PWR_CR_VOS_POS);
+  RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_PRE_MASK) | config->cfgr_prescalers;
+
+  if (config->pllcfgr != 0) {
+    RCC->PLLCFGR = config->pllcfgr;
+    RCC->CR |= RCC_CR_PLLON;
+    while (!(RCC->CR & RCC_CR_PLLRDY)) {}
+    while (!(PWR->CSR & PWR_CSR_VOSRDY)) {}
+    perfSelectClock(RCC_CFGR_SW_PLL);
+  }
+
+  perf_current = config;
+  criticalExit(basepri);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+uint32_t perfHclkHz(void) {
+  return (perf_current != NULL) ? perf_current->hclk_hz : HSI_HZ;
+}
+
+
+/**************************************************************************************************/
+uint32_t perfApb1Hz(void) {
+  return (perf_current != NULL) ? perf_current->hclk_hz / perf_current->apb1_div : HSI_HZ;
+}
+
+
+/**************************************************************************************************/
+uint32_t perfApb2Hz(void) {
+  return perfHclkHz();
+}
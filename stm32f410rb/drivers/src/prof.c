@@ -0,0 +1,164 @@
+/***************************************************************************************************
+ * @file        prof.c
+ *
+ * @brief       Source file for the statistical sampling profiler.
+ *
+ * @details     This file implements a sampling profiler driven by the TIM11 update interrupt.
+ *              On every update event the interrupt handler recovers the stacked program counter
+ *              of the interrupted code from the exception frame and increments the histogram bin
+ *              that covers it.
+ *
+ * @see         PM0214 Programming Manual, Page 40 for more information on the exception stack
+ *              frame.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+#include "prof.h"
+#include "err.h"
+#include "nvic.h"
+#include "clk.h"
+#include "mem.h"
+#include "lpm.h"
+
+
+#define     FLASH_START         (0x08000000UL)
+
+
+extern uint32_t _etext;
+
+
+volatile ProfHistogram prof_histogram;
+static uint8_t prof_running;                      // TIM11 running, Stop mode locked
+
+
+/***************************************************************************************************
+ * @brief       Adds one sample to the histogram.
+ *
+ * @details     Called from TIM1_TRG_COM_TIM11_ISR with the stacked PC of the interrupted code.
+ *              The update flag is cleared here so that the handler itself stays branch-free.
+ *
+ * @param       pc    Program counter of the interrupted instruction.
+ */
+static void __attribute__((used)) profSample(uint32_t pc) {
+  TIM11->SR = ~(1UL << 0);    // Clear update interrupt flag (rc_w0)
+
+  prof_histogram.samples++;
+
+  uint32_t bin = (pc - prof_histogram.base) >> prof_histogram.shift;
+  if (pc < prof_histogram.base || bin >= prof_histogram.bins) {
+    prof_histogram.outside++;
+  } else if (prof_histogram.count[bin] != 0xFFFF) {
+    prof_histogram.count[bin]++;
+  }
+}
+
+
+/***************************************************************************************************
+ * @details     The histogram covers FLASH_START up to _etext. The bin width is the smallest power
+ *              of two that fits that range in PROF_MAX_BINS bins.
+ *              TIM11 is configured as an up-counter whose update event fires at sample_hz, with the
+ *              prescaler chosen so that the auto-reload value fits in 16 bits.
+ */
+int profStart(uint32_t timer_clk_hz, uint32_t sample_hz) {
+  if (sample_hz == 0 || sample_hz > timer_clk_hz / 2) {   // ARR must be at least 1 to update
+    triggerError(2, 1); // Wrong sampling rate
+    return 1;
+  }
+
+  profStop();
+
+  uint32_t size = (uint32_t)&_etext - FLASH_START;
+  uint16_t shift = 0;
+  while ((size >> shift) >= PROF_MAX_BINS) shift++;
+
+  prof_histogram.magic = PROF_MAGIC;
+  prof_histogram.base = FLASH_START;
+  prof_histogram.shift = shift;
+  prof_histogram.bins = (uint16_t)((size >> shift) + 1);
+  prof_histogram.samples = 0;
+  prof_histogram.outside = 0;
+  memset((void *)prof_histogram.count, 0, sizeof(prof_histogram.count));  // Timer is stopped
+
+  uint32_t ticks = timer_clk_hz / sample_hz;
+  uint32_t prescaler = (ticks - 1) >> 16;
+
+  if (clkEnable(kClkTim11)) return 1;
+  prof_running = 1;
+  lpmStopLock();                // TIM11 stops in Stop mode
+  TIM11->CR1 = 0;
+  TIM11->PSC = prescaler;
+  TIM11->ARR = ticks / (prescaler + 1) - 1;
+  TIM11->EGR = (1 << 0);        // Load prescaler and auto-reload
+  TIM11->SR = 0;
+  TIM11->DIER = (1 << 0);       // Update interrupt enable
+
+  nvicSetPriority(kIrqTim1TrgComTim11, 0);        // Highest priority
+  nvicEnable(kIrqTim1TrgComTim11);
+
+  TIM11->CR1 = (1 << 0);        // Counter enable
+  return 0;
+}
+
+
+/**************************************************************************************************/
+void profStop(void) {
+  if (!prof_running) return;
+
+  TIM11->CR1 = 0;
+  nvicDisable(kIrqTim1TrgComTim11);
+  clkRelease(kClkTim11);
+  lpmStopUnlock();
+  prof_running = 0;
+}
+
+
+/**************************************************************************************************/
+void profDump(void (*put_byte)(uint8_t byte)) {
+  const volatile uint8_t *bytes = (const volatile uint8_t *)&prof_histogram;
+  uint32_t length = (uint32_t)((const volatile uint8_t *)&prof_histogram.count[0] - bytes)
+                    + prof_histogram.bins * sizeof(prof_histogram.count[0]);
+
+  for (uint32_t i = 0; i < length; i++) put_byte(bytes[i]);
+}
+
+
+/***************************************************************************************************
+ * @brief       Interrupt Service Routine for TIM1 trigger/commutation and TIM11.
+ *
+ * @details     On exception entry the processor pushes R0-R3, R12, LR, PC and xPSR, so the PC of
+ *              the interrupted code sits at offset 24 of the frame. Bit 2 of EXC_RETURN (LR)
+ *              tells whether the frame was pushed on the main or on the process stack.
+ *              The handler is naked so that SP still points at the frame when it is read.
+ */
+void __attribute__((naked)) TIM1_TRG_COM_TIM11_ISR(void) {
+  asm volatile(
+    "tst lr, #4\n"                  // Check which stack holds the exception frame
+    "ite eq\n"
+    "mrseq r0, msp\n"
+    "mrsne r0, psp\n"
+    "ldr r0, [r0, #24]\n"           // Load the stacked PC
+    "b profSample\n"                // Tail call, profSample returns through LR (EXC_RETURN)
+  );
+}
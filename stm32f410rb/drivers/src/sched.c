@@ -0,0 +1,118 @@
+/***************************************************************************************************
+ * @file        sched.c
+ *
+ * @brief       Source file for the cooperative run-to-completion scheduler.
+ *
+ * @details     This file implements the task table, the per-task event queues and the dispatch
+ *              loop. Queues and the ready bitmap are only modified inside critical sections, and
+ *              handlers always run with interrupts enabled.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sched.h"
+#include "err.h"
+#include "atomic.h"
+#include "lpm.h"
+
+
+/***************************************************************************************************
+ * @brief       Task control block.
+ */
+typedef struct {
+  SchedHandler handler;
+  uint8_t head;                           // Next slot to write (free-running)
+  uint8_t tail;                           // Next slot to read (free-running)
+  uint32_t queue[SCHED_QUEUE_SIZE];
+} SchedTask;
+
+
+static SchedTask sched_tasks[SCHED_MAX_TASKS];
+static volatile uint32_t sched_ready;     // Bit (31 - p) set when task p has queued events
+
+
+/**************************************************************************************************/
+int schedTaskCreate(uint8_t priority, SchedHandler handler) {
+  if (priority >= SCHED_MAX_TASKS || handler == NULL || sched_tasks[priority].handler != NULL) {
+    triggerError(4, 1); // Wrong priority or priority already in use
+    return 1;
+  }
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  sched_tasks[priority].head = 0;
+  sched_tasks[priority].tail = 0;
+  sched_tasks[priority].handler = handler;
+  criticalExit(basepri);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+int schedPost(uint8_t priority, uint32_t event) {
+  if (priority >= SCHED_MAX_TASKS || sched_tasks[priority].handler == NULL) {
+    triggerError(4, 2); // Posting to a task that does not exist
+    return 1;
+  }
+
+  SchedTask *task = &sched_tasks[priority];
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+
+  if ((uint8_t)(task->head - task->tail) >= SCHED_QUEUE_SIZE) {
+    criticalExit(basepri);
+    return 1;   // Queue full
+  }
+  task->queue[task->head++ & (SCHED_QUEUE_SIZE - 1)] = event;
+  sched_ready |= (0x80000000UL >> priority);
+
+  criticalExit(basepri);
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     The ready check and lpmIdle() are executed with PRIMASK set: a pending interrupt
+ *              still wakes the core from WFI, and it is serviced as soon as PRIMASK is cleared.
+ *              This closes the window in which an interrupt could post an event after the check
+ *              but before the WFI, which would leave the event waiting for the next interrupt.
+ */
+void schedRun(void) {
+  while (1) {
+    uint32_t primask = criticalEnterAll();
+
+    if (sched_ready == 0) {
+      lpmIdle();
+      criticalExitAll(primask);
+      continue;
+    }
+
+    uint32_t priority = __builtin_clz(sched_ready);   // Compiles to a single CLZ
+    SchedTask *task = &sched_tasks[priority];
+    uint32_t event = task->queue[task->tail++ & (SCHED_QUEUE_SIZE - 1)];
+    if (task->tail == task->head) sched_ready &= ~(0x80000000UL >> priority);
+
+    criticalExitAll(primask);
+
+    task->handler(event);
+  }
+}
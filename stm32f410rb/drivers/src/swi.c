@@ -0,0 +1,131 @@
+/***************************************************************************************************
+ * @file        swi.c
+ *
+ * @brief       Source file for the software interrupt service.
+ *
+ * @details     This file implements the software interrupt channels and their interrupt handlers.
+ *              The event bits are kept in SRAM and updated with LDREX/STREX, so triggering a
+ *              channel never masks interrupts: it is one atomic OR and one write to STIR.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "swi.h"
+#include "err.h"
+#include "atomic.h"
+#include "nvic.h"
+
+
+#define FPSCR_EXCEPTIONS    (0x9FUL)    // Cumulative exception flags: IDC, IXC, UFC, OFC, DZC, IOC
+#define FPCCR_LSPACT        (1UL << 0)  // Lazy stacking of the interrupted FPU context pending
+
+
+static const NvicIrq swi_irq[kSwiCount] = { kIrqExti19, kIrqExti20, kIrqFpu };
+static SwiHandler swi_handlers[kSwiCount];
+static volatile uint32_t swi_events[kSwiCount];
+
+
+/***************************************************************************************************
+ * @brief       Takes the pending events of a channel and runs its handler with them.
+ *
+ * @details     The events are taken before calling the handler, so a trigger that happens while
+ *              it runs pends the interrupt again and is handled in the next call.
+ */
+static void swiDispatch(SwiChannel channel) {
+  uint32_t events = atomicClearBits(&swi_events[channel], 0xFFFFFFFFUL);
+
+  if (events != 0) swi_handlers[channel](events);
+}
+
+
+/***************************************************************************************************
+ * @details     Events left over from a previous use of the channel are discarded.
+ */
+int swiInit(SwiChannel channel, uint8_t priority, SwiHandler handler) {
+  if (channel >= kSwiCount || handler == NULL) {
+    triggerError(8, 1); // Wrong channel or null handler
+    return 1;
+  }
+  if (priority < CRITICAL_DRIVER_PRIORITY || priority > 15) {
+    triggerError(8, 2); // Wrong interrupt priority
+    return 1;
+  }
+
+  NvicIrq irq = swi_irq[channel];
+
+  nvicDisable(irq);
+  swi_handlers[channel] = handler;
+  swi_events[channel] = 0;
+  nvicClearPending(irq);
+
+  nvicSetPriority(irq, priority);
+  nvicEnable(irq);
+  return 0;
+}
+
+
+/***************************************************************************************************
+ * @details     The arguments are not checked, to keep the cost of a trigger as low as possible.
+ *              STIR takes the interrupt number and pends it like a write to ISPR would, without
+ *              having to compute the register and bit.
+ */
+void swiTrigger(SwiChannel channel, uint32_t events) {
+  atomicSetBits(&swi_events[channel], events);
+  NVIC->STIR = swi_irq[channel];
+}
+
+
+/**************************************************************************************************/
+void EXTI19_ISR(void) {
+  swiDispatch(kSwi0);
+}
+
+
+/**************************************************************************************************/
+void EXTI20_ISR(void) {
+  swiDispatch(kSwi1);
+}
+
+
+/***************************************************************************************************
+ * @details     The FPU also raises this interrupt while an exception flag is set in FPSCR, so the
+ *              flags are cleared in the FPSCR restored on exception return: the one reserved in
+ *              the stack frame if the interrupted code had an FPU context (reading FPSCR stacks
+ *              it), the live one otherwise. swiDispatch() ignores the call if no event is pending.
+ */
+void FPU_ISR(void) {
+#ifdef __ARM_FP
+  uint32_t lazy = FPU->FPCCR & FPCCR_LSPACT;
+  uint32_t fpscr;
+
+  asm volatile("vmrs %0, fpscr" : "=r" (fpscr) : : "memory");
+  if (lazy)
+    *(volatile uint32_t *)(FPU->FPCAR + 0x40) = fpscr & ~FPSCR_EXCEPTIONS;   // After S0-S15
+  else
+    asm volatile("vmsr fpscr, %0" : : "r" (fpscr & ~FPSCR_EXCEPTIONS) : "memory");
+#endif
+
+  swiDispatch(kSwi2);
+}
@@ -0,0 +1,203 @@
+/***************************************************************************************************
+ * @file        swtimer.c
+ *
+ * @brief       Source file for the software timer service.
+ *
+ * @details     This file implements the timing wheel. Every slot is a doubly linked list in which
+ *              each timer keeps a pointer to the link that points to it, so a timer is removed in
+ *              constant time without searching its slot.
+ *
+ *              swtimer_now is the next tick to be processed. A timer expiring on tick t is kept in
+ *              level n when t - swtimer_now < 64^(n + 1), in the slot given by bits [6n, 6n + 6)
+ *              of t. Whenever the level 0 index wraps to 0, the current slot of level 1 is emptied
+ *              and its timers re-inserted (they all fit in level 0 by then), and so on upwards.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "swtimer.h"
+#include "err.h"
+#include "atomic.h"
+#include "lpm.h"
+
+
+#define SWTIMER_SLOTS       (1UL << SWTIMER_LEVEL_BITS)
+#define SWTIMER_SLOT_MASK   (SWTIMER_SLOTS - 1)
+
+
+static SwTimer *swtimer_wheel[SWTIMER_LEVELS][SWTIMER_SLOTS];
+static SwTimer *swtimer_expiring;         // Timers of the slot being processed
+static volatile uint32_t swtimer_now;
+static uint32_t swtimer_running;          // Running timers, Stop mode is locked while not 0
+
+
+/***************************************************************************************************
+ * @brief       Pushes a timer at the front of a list.
+ */
+static void swtimerLink(SwTimer **head, SwTimer *timer) {
+  timer->next = *head;
+  if (timer->next != NULL) timer->next->pprev = &timer->next;
+  timer->pprev = head;
+  *head = timer;
+}
+
+
+/***************************************************************************************************
+ * @brief       Removes a timer from the list it is in.
+ */
+static void swtimerUnlink(SwTimer *timer) {
+  *timer->pprev = timer->next;
+  if (timer->next != NULL) timer->next->pprev = timer->pprev;
+  timer->next = NULL;
+  timer->pprev = NULL;
+}
+
+
+/***************************************************************************************************
+ * @brief       Inserts a timer in the wheel according to its expiry time. Must be called inside a
+ *              critical section.
+ */
+static void swtimerInsert(SwTimer *timer) {
+  uint32_t delta = timer->expires - swtimer_now;
+  uint32_t level = 0;
+
+  while (level < SWTIMER_LEVELS - 1 && delta >= (1UL << (SWTIMER_LEVEL_BITS * (level + 1)))) {
+    level++;
+  }
+
+  uint32_t slot = (timer->expires >> (SWTIMER_LEVEL_BITS * level)) & SWTIMER_SLOT_MASK;
+  swtimerLink(&swtimer_wheel[level][slot], timer);
+}
+
+
+/***************************************************************************************************
+ * @brief       Re-inserts every timer of a slot of an upper level, which moves them down.
+ *
+ * @return      The index of the slot, 0 meaning that the next level must be cascaded as well.
+ */
+static uint32_t swtimerCascade(uint32_t level) {
+  uint32_t slot = (swtimer_now >> (SWTIMER_LEVEL_BITS * level)) & SWTIMER_SLOT_MASK;
+  SwTimer *timer = swtimer_wheel[level][slot];
+
+  swtimer_wheel[level][slot] = NULL;
+  while (timer != NULL) {
+    SwTimer *next = timer->next;
+    swtimerInsert(timer);
+    timer = next;
+  }
+  return slot;
+}
+
+
+/**************************************************************************************************/
+void swtimerInit(SwTimer *timer, SwTimerCallback callback, void *arg) {
+  timer->next = NULL;
+  timer->pprev = NULL;
+  timer->expires = 0;
+  timer->period = 0;
+  timer->callback = callback;
+  timer->arg = arg;
+}
+
+
+/**************************************************************************************************/
+int swtimerStart(SwTimer *timer, uint32_t ticks, uint32_t period) {
+  if (ticks == 0 || ticks > SWTIMER_MAX_TICKS || period > SWTIMER_MAX_TICKS) {
+    triggerError(6, 1); // Wrong delay or period
+    return 1;
+  }
+
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  if (timer->pprev != NULL)
+    swtimerUnlink(timer);
+  else if (swtimer_running++ == 0)
+    lpmStopLock();
+  timer->expires = swtimer_now + ticks - 1;
+  timer->period = period;
+  swtimerInsert(timer);
+  criticalExit(basepri);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+void swtimerStop(SwTimer *timer) {
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  if (timer->pprev != NULL) {
+    swtimerUnlink(timer);
+    if (--swtimer_running == 0) lpmStopUnlock();
+  }
+  criticalExit(basepri);
+}
+
+
+/**************************************************************************************************/
+int swtimerActive(const SwTimer *timer) {
+  return timer->pprev != NULL;
+}
+
+
+/***************************************************************************************************
+ * @details     The expiring slot is moved to swtimer_expiring before running any callback, so a
+ *              callback may start or stop any timer, itself included. Periodic timers are
+ *              re-inserted before their callback runs.
+ */
+void swtimerTick(void) {
+  uint32_t basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  uint32_t slot = swtimer_now & SWTIMER_SLOT_MASK;
+
+  for (uint32_t level = 1; slot == 0 && level < SWTIMER_LEVELS; level++) {
+    slot = swtimerCascade(level);
+  }
+
+  slot = swtimer_now & SWTIMER_SLOT_MASK;
+  swtimer_expiring = swtimer_wheel[0][slot];
+  swtimer_wheel[0][slot] = NULL;
+  if (swtimer_expiring != NULL) swtimer_expiring->pprev = &swtimer_expiring;
+  swtimer_now++;
+
+  SwTimer *timer;
+  while ((timer = swtimer_expiring) != NULL) {
+    swtimerUnlink(timer);
+    if (timer->period != 0) {
+      timer->expires += timer->period;
+      swtimerInsert(timer);
+    }
+    else if (--swtimer_running == 0) {
+      lpmStopUnlock();
+    }
+
+    criticalExit(basepri);
+    timer->callback(timer->arg);
+    basepri = criticalEnter(CRITICAL_DRIVER_PRIORITY);
+  }
+
+  criticalExit(basepri);
+}
+
+
+/**************************************************************************************************/
+uint32_t swtimerNow(void) {
+  return swtimer_now;
+}
@@ -0,0 +1,95 @@
+/***************************************************************************************************
+ * @file        trace.c
+ *
+ * @brief       Source file for the binary event trace buffer.
+ *
+ * @details     This file implements a lock-free event recorder. A record slot is claimed by
+ *              atomically incrementing the head index with LDREX/STREX. The exception entry and
+ *              return sequences clear the local exclusive monitor, so if an interrupt handler
+ *              records an event between the LDREX and the STREX of the interrupted code, the
+ *              STREX fails and the interrupted code retries with the new head value.
+ *
+ * @see         PM0214 Programming Manual, Page 84 for more information on LDREX and STREX.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include "stm32f410rb.h"
+#include "trace.h"
+#include "atomic.h"
+#include "dwt.h"
+
+
+volatile TraceBuffer trace_buffer;
+
+
+/***************************************************************************************************
+ * @brief       Atomically increments the head index.
+ *
+ * @return      The head value before the increment, i.e. the sequence number of the claimed slot.
+ */
+static inline uint32_t traceClaim(void) {
+  return atomicAdd(&trace_buffer.head, 1) - 1;
+}
+
+
+/**************************************************************************************************/
+void traceInit(void) {
+  trace_buffer.enabled = 0;
+
+  dwtInit();
+
+  trace_buffer.magic = TRACE_MAGIC;
+  trace_buffer.size = TRACE_SIZE;
+  trace_buffer.head = 0;
+  trace_buffer.enabled = 1;
+}
+
+
+/**************************************************************************************************/
+void traceStop(void) {
+  trace_buffer.enabled = 0;
+}
+
+
+/***************************************************************************************************
+ * @details     The record is written with two word stores, the second one packing the type, the
+ *              identifier and the argument.
+ */
+void traceRecord(TraceType type, uint8_t id, uint16_t arg) {
+  if (!trace_buffer.enabled) return;
+
+  uint32_t slot = traceClaim() & (TRACE_SIZE - 1);
+  volatile uint32_t *record = (volatile uint32_t *)&trace_buffer.record[slot];
+
+  record[0] = dwtCycles();
+  record[1] = (uint32_t)type | ((uint32_t)id << 8) | ((uint32_t)arg << 16);
+}
+
+
+/**************************************************************************************************/
+void traceDump(void (*put_byte)(uint8_t byte)) {
+  const volatile uint8_t *bytes = (const volatile uint8_t *)&trace_buffer;
+
+  for (uint32_t i = 0; i < sizeof(trace_buffer); i++) put_byte(bytes[i]);
+}
@@ -6,13 +6,14 @@
  * @details     This code defines the Nested Vectored Interrupt Controller (NVIC)
  *              with the corresponding interrupts defined in the reference manual RM0401.
  *              It implements the Reset_ISR(), which copies the .data section from
- *              flash memory to SRAM and initializes it to zero. It also initializes the
- *              .bss section in SRAM to zero. Finally, it calls the main() function as
- *              the program's entry point
+ *              flash memory to SRAM and initializes the .bss section in SRAM to zero, both a word
+ *              at a time. Finally, it calls the main() function as the program's entry point.
+ *              When built for the hardware FPU (-mfloat-abi=softfp or hard), it first enables
+ *              the FPU with lazy stacking.
  * 
  * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
  * 
- * @date        Last Updated:   21/07/2023
+ * @date        Last Updated:   18/10/2026
  * 
  * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
  * 
@@ -35,7 +36,7 @@
 #include <stdint.h>
 
 
-extern uint32_t _etext;
+extern uint32_t _sidata;
 extern uint32_t _sdata;
 extern uint32_t _edata;
 extern uint32_t _sbss;
@@ -46,6 +47,12 @@ extern uint32_t _ebss;
 #define     SRAM_END        (SRAM_START + SRAM_SIZE)
 #define     STACK_START     (SRAM_END)
 
+#define     SCB_CPACR       (*(volatile uint32_t *)0xE000ED88UL)
+#define     FPU_FPCCR       (*(volatile uint32_t *)0xE000EF34UL)
+#define     CPACR_CP10_CP11 (0xFUL << 20)   // Full access to the FPU
+#define     FPCCR_ASPEN     (1UL << 31)     // Automatic FPU state preservation on exception entry
+#define     FPCCR_LSPEN     (1UL << 30)     // Lazy stacking of that state
+
 
 /***************************************************************************************************
  * @brief       Macro to define the attributes of an overridable function
@@ -278,34 +285,43 @@ int main(void);
  *              by setting it to zero, and then calling the user-defined main function.
  */
 void Reset_ISR(void) {
-  // Copy .data section to SRAM
+#ifdef __ARM_FP
+  // Enable the FPU before any floating-point instruction runs. Exceptions then only reserve space
+  // for S0-S15 and FPSCR in their frame, which is filled only if the handler uses the FPU
+  SCB_CPACR |= CPACR_CP10_CP11;
+  FPU_FPCCR |= FPCCR_ASPEN | FPCCR_LSPEN;
+  asm volatile("dsb\n" "isb\n" : : : "memory");
+#endif
+
+  // Copy .data section to SRAM. The linker script aligns both sections to words, so the copy and
+  // the zeroing below move a word at a time
   uint32_t size = (uint32_t)&_edata - (uint32_t)&_sdata;
-  uint8_t *pDestination = (uint8_t*)&_sdata;  // SRAM
-  uint8_t *pSource = (uint8_t*)&_etext;   // FLASH
+  uint32_t *pDestination = &_sdata;   // SRAM
+  uint32_t *pSource = &_sidata;       // FLASH, load address of .data
 
   asm volatile(
     "mov r0, %[pDestination]\n"     // Load the start address of the destination into r0
-    "mov r1, %[size]\n"             // Load the size of the copy into r1
-    "mov r2, #0\n"                  // Initialize r2 with zero
+    "mov r1, %[pSource]\n"          // Load the start address of the source into r1
+    "mov r2, %[size]\n"             // Load the size of the copy into r2
 
     "copy_loop:\n"
-      "cmp r1, #0\n"              // Compare the size with zero
+      "cmp r2, #0\n"              // Compare the size with zero
       "beq copy_end\n"            // Branch to copy_end if size is zero
-      "ldrb r3, [%[pSource]]\n"   // Load a byte from the source address
-      "strb r3, [r0], #1\n"       // Store the byte to the destination address and increment the destination pointer
-      "subs r1, r1, #1\n"         // Subtract 1 from size
+      "ldr r3, [r1], #4\n"        // Load a word from the source and increment the source pointer
+      "str r3, [r0], #4\n"        // Store the word to the destination and increment the destination
+      "subs r2, r2, #4\n"         // Subtract 4 from size
       "b copy_loop\n"             // Branch back to copy_loop
 
     "copy_end:\n"
     :
     : [pDestination] "r" (pDestination), [size] "r" (size), [pSource] "r" (pSource)
-    : "r0", "r1", "r2", "r3"
+    : "r0", "r1", "r2", "r3", "memory"
   );
 
   // Initialize .bss section to zero
   size = (uint32_t)&_ebss - (uint32_t)&_sbss;
-  pDestination = (uint8_t*)&_sbss;
-      
+  pDestination = &_sbss;
+
   asm volatile(
     "mov r0, %[dest]\n"             // Load the start address of .bss section into r0
     "mov r1, %[size]\n"             // Load the size of .bss section into r1
@@ -314,14 +330,14 @@ void Reset_ISR(void) {
     "loop:\n"
       "cmp r1, #0\n"              // Compare the size with zero
       "beq end\n"                 // Branch to end if size is zero
-      "strb r2, [r0], #1\n"       // Store byte zero at the current address and increment the address
-      "subs r1, r1, #1\n"         // Subtract 1 from size
+      "str r2, [r0], #4\n"        // Store zero at the current address and increment the address
+      "subs r1, r1, #4\n"         // Subtract 4 from size
       "b loop\n"                  // Branch back to the loop
 
     "end:\n"
     :
     : [dest] "r" (pDestination), [size] "r" (size)
-    : "r0", "r1", "r2"
+    : "r0", "r1", "r2", "memory"
   );
 
   // Call program entry point
@@ -0,0 +1,146 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       ADC Scan and DMA Test
+ *
+ * @details     This file contains a program that runs the ADC driver in both trigger modes, with a
+ *              sequence of two channels (PA0 and PA1, A0 and A1 of the Nucleo board) into a DMA
+ *              double buffer:
+ *
+ *              1. TIM5 at BENCH_TIMER_HZ sequences per second: the number of half buffers received
+ *                 in BENCH_TIMER_MS must match the rate, and the averages of each channel show the
+ *                 input voltages (0 - 4095 for 0 - 3.3 V).
+ *              2. Continuous mode: the sample rate is measured between the first and the last half
+ *                 buffer received, with the DWT cycle counter, and compared with the rate the ADC
+ *                 should sustain (adcMaxRate()).
+ *
+ *              The handler only adds the first sequence of every half buffer and takes a
+ *              timestamp, the CPU never reads the ADC. The balanced profile gives a 32 MHz ADC
+ *              clock (2.13 MSPS with 3 cycles of sampling).
+ *
+ *              The LED on PA5 turns on if no overrun happened and the rates match. The results are
+ *              read with the debugger (make ocd, then "print bench_adc" in gdb).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "dwt.h"
+#include "perf.h"
+#include "adc.h"
+
+#define BENCH_CHANNELS    (2U)
+#define BENCH_HALF        (512U)          // Samples per half buffer
+#define BENCH_TIMER_HZ    (25600U)        // Sequences per second in timer mode
+#define BENCH_TIMER_MS    (100U)
+#define BENCH_HALVES      (64U)           // Half buffers measured in continuous mode
+
+typedef struct {
+  uint32_t timer_halves;
+  uint32_t timer_expected;      // BENCH_TIMER_HZ * BENCH_CHANNELS * BENCH_TIMER_MS / 1000 / half
+  uint32_t average[BENCH_CHANNELS];
+  uint32_t max_rate_sps;        // adcMaxRate() * BENCH_CHANNELS
+  uint32_t measured_rate_sps;
+  uint32_t overruns;
+  uint32_t dma_errors;
+} BenchResult;
+
+volatile BenchResult bench_adc;
+
+static const uint8_t bench_channels[BENCH_CHANNELS] = { 0, 1 };
+static uint16_t bench_buffer[2 * BENCH_HALF];
+
+static volatile uint32_t bench_halves;
+static volatile uint32_t bench_first_cycles;
+static volatile uint32_t bench_last_cycles;
+static volatile uint32_t bench_sum[BENCH_CHANNELS];
+
+void benchHandler(const uint16_t *samples, uint32_t count);
+void benchWait(uint32_t ms);
+
+int main(void) {
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+  perfSetProfile(kPerfBalanced);
+
+  dwtInit();
+
+  adcInit(bench_channels, BENCH_CHANNELS, kAdcSample3, bench_buffer, BENCH_HALF, 2, benchHandler);
+
+  // 1. Timer trigger
+  bench_halves = 0;
+  adcStart(BENCH_TIMER_HZ);
+  benchWait(BENCH_TIMER_MS);
+  adcStop();
+
+  bench_adc.timer_halves = bench_halves;
+  bench_adc.timer_expected = BENCH_TIMER_HZ * BENCH_CHANNELS / BENCH_HALF * BENCH_TIMER_MS / 1000;
+  for (uint32_t i = 0; i < BENCH_CHANNELS && bench_halves != 0; i++) {
+    bench_adc.average[i] = bench_sum[i] / bench_halves;
+  }
+
+  // 2. Continuous conversions
+  bench_halves = 0;
+  adcStart(0);
+  while (bench_halves < BENCH_HALVES) {}
+  adcStop();
+
+  uint64_t samples = (uint64_t)(BENCH_HALVES - 1) * BENCH_HALF;
+
+  bench_adc.max_rate_sps = adcMaxRate() * BENCH_CHANNELS;
+  bench_adc.measured_rate_sps = samples * perfHclkHz() / (bench_last_cycles - bench_first_cycles);
+  bench_adc.overruns = adcOverruns();
+  bench_adc.dma_errors = adcDmaErrors();
+
+  // Within 1 half buffer and 1 %
+  uint32_t timer_diff = bench_adc.timer_halves - bench_adc.timer_expected + 1;
+  uint32_t rate_diff = bench_adc.max_rate_sps - bench_adc.measured_rate_sps +
+                       bench_adc.max_rate_sps / 100;
+
+  if (bench_adc.overruns == 0 && bench_adc.dma_errors == 0 && timer_diff <= 2 &&
+      rate_diff <= bench_adc.max_rate_sps / 50) {
+    gpioPinWrite(GPIOA, 5, 1, NULL);
+  }
+
+  while (1) {}
+}
+
+void benchHandler(const uint16_t *samples, uint32_t count) {
+  (void)count;
+
+  bench_last_cycles = dwtCycles();
+  if (bench_halves == 0) {
+    bench_first_cycles = bench_last_cycles;
+    for (uint32_t i = 0; i < BENCH_CHANNELS; i++) bench_sum[i] = 0;
+  }
+  for (uint32_t i = 0; i < BENCH_CHANNELS; i++) bench_sum[i] += samples[i];
+  bench_halves++;
+}
+
+void benchWait(uint32_t ms) {
+  uint32_t start = dwtCycles();
+  uint32_t cycles = perfHclkHz() / 1000 * ms;
+
+  while (dwtCycles() - start < cycles) {}
+}
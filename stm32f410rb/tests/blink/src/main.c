@@ -34,6 +34,7 @@
  */
 
 #include "stm32f410rb.h"
+#include "nvic.h"
 
 int main(void) {
     RCC->AHB1ENR |= (1 << 0);       // Enable clock for GPIOA
@@ -54,8 +55,8 @@ int main(void) {
     EXTI->FTSR &= ~(1 << 13); 
     EXTI->RTSR |= (1 << 13);    // Enable rising edge trigger
 
-    NVIC->ISER[1] |= (1 << 8);  // Enable interrupt
-    NVIC->IPR[40] |= (1 << 4);  // Set priority
+    nvicSetPriority(kIrqExti15_10, 1);
+    nvicEnable(kIrqExti15_10);  // Enable interrupt
     
     // Loop
     while (1) {}
@@ -70,6 +71,6 @@ void EXTI15_10_ISR(void) {
       GPIOA->ODR ^= (1 << 5);   // Toggle LED (PA5)
       for (int j = 0; j < 100000; j++);
     }
-    EXTI->PR |= (1 << 13);    // Clear flag
+    EXTI->PR = (1 << 13);     // Clear flag (write-one-to-clear)
   }
 }
\ No newline at end of file
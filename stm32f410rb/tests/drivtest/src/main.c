@@ -4,10 +4,15 @@
  * @brief       Driver Test File
  *
  * @details     This file contains a simple program to test the usage of my drivers library.
+ *
+ *              The time spent in Stop mode between button presses is measured with LPTIM1, which
+ *              counts LSI / 32 (about 1 kHz) in Stop mode and wakes the core up when it wraps to
+ *              refresh drivtest_lpm. The results are read with the debugger (make ocd, then
+ *              "print drivtest_lpm" in gdb).
  * 
  * @author      Hiram Montejano Gómez
  * 
- * @date        Last Updated:   15/07/2023
+ * @date        Last Updated:   18/10/2026
  * 
  * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
  * 
@@ -30,7 +35,20 @@
 #include <stddef.h>
 #include "stm32f410rb.h"
 #include "gpio.h"
+#include "lpm.h"
+#include "clk.h"
+#include "nvic.h"
+#include "atomic.h"
+#include "bitband.h"
+
+#define LPTIM_HZ  (32000U / 32)     // Typical LSI, between 17 and 47 kHz (datasheet table 43)
+
+LpmStats drivtest_lpm;
 
+static volatile uint32_t lptim_wraps;
+
+void lptimInit(void);
+uint32_t lptimClock(void);
 void buttonHandler1(void);
 void buttonHandler2(void);
 void buttonHandler3(void);
@@ -51,6 +69,11 @@ int main(void) {
   gpioInterruptSet(GPIOC, 7, 1, 14, buttonHandler3);
   gpioInterruptSet(GPIOA, 12, 1, 0, buttonHandler4);
 
+  // Everything happens in the button handlers, stay in Stop mode between them
+  lptimInit();
+  lpmInit(lptimClock, LPTIM_HZ);
+  lpmSleepOnExit(kLpmStop);
+
   while (1) {}
 }
 
@@ -73,4 +96,46 @@ void buttonHandler3(void) {
 
 void buttonHandler4(void) {
   gpioPinWrite(GPIOC, 4, 1, NULL);
-}
\ No newline at end of file
+}
+
+void lptimInit(void) {
+  RCC->CSR |= (1 << 0);                                     // LSION
+  while (!(RCC->CSR & (1 << 1))) {}                         // Wait for LSIRDY
+  RCC->DCKCFGR2 = (RCC->DCKCFGR2 & ~(3UL << 30)) | (2UL << 30);   // LPTIM1 clocked from LSI
+  clkEnable(kClkLptim1);
+
+  LPTIM1->CFGR = (5 << 9);                                  // Prescaler /32
+  LPTIM1->IER = (1 << 1);                                   // Autoreload match interrupt
+  LPTIM1->CR = (1 << 0);                                    // Enable, ARR can only be written now
+  LPTIM1->ARR = 0xFFFF;
+  while (!(LPTIM1->ISR & (1 << 4))) {}                      // Wait for ARROK
+  LPTIM1->ICR = (1 << 4);
+  LPTIM1->CR = (1 << 0) | (1 << 2);                         // Continuous mode
+
+  BITBAND_PERIPH(EXTI->RTSR, 23) = 1;                       // EXTI line 23 wakes up from Stop
+  BITBAND_PERIPH(EXTI->IMR, 23) = 1;
+  nvicSetPriority(kIrqExti23Lptim1, 15);
+  nvicEnable(kIrqExti23Lptim1);
+}
+
+uint32_t lptimClock(void) {
+  uint32_t primask = criticalEnterAll();
+  uint32_t count;
+
+  do {                                                      // CNT is asynchronous to the APB
+    count = LPTIM1->CNT;
+  } while (count != LPTIM1->CNT);
+
+  uint32_t wraps = lptim_wraps;
+  if ((LPTIM1->ISR & (1 << 1)) && count < 0x8000) wraps++;  // Wrapped, interrupt not taken yet
+  criticalExitAll(primask);
+
+  return (wraps << 16) | count;
+}
+
+void EXTI23_LPTIM1_ISR(void) {
+  LPTIM1->ICR = (1 << 1);                                   // Clear ARRM
+  EXTI->PR = (1 << 23);
+  lptim_wraps++;
+  lpmGetStats(&drivtest_lpm);                                  // At least once per wrap of LPTIM1
+}
@@ -0,0 +1,129 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       Floating-Point ABI Benchmark
+ *
+ * @details     This file contains a program that measures a float-heavy kernel with the DWT cycle
+ *              counter, to compare the software floating-point helpers of libgcc against the FPU.
+ *              The same source is built once per ABI:
+ *
+ *                  make clean all FLOAT_ABI=soft       (in drivers/ and here)
+ *                  make clean all FLOAT_ABI=hard
+ *
+ *              The kernel scales raw 12-bit ADC readings of a sensor the way an application would:
+ *              conversion to volts, a third-order calibration polynomial and a first-order low-pass
+ *              filter, all in single precision.
+ *
+ *              bench_float.abi tells which build is running (0 soft, 1 softfp, 2 hard), and
+ *              bench_float.output_milli must be the same in every build. The LED on PA5 turns on
+ *              when the benchmark ends. The results are read with the debugger (make ocd, then
+ *              "print bench_float" in gdb).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "dwt.h"
+
+#define BENCH_SAMPLES   (256U)
+#define BENCH_PASSES    (4U)
+
+#if !defined(__ARM_FP)
+#define BENCH_ABI       (0U)
+#elif !defined(__ARM_PCS_VFP)
+#define BENCH_ABI       (1U)
+#else
+#define BENCH_ABI       (2U)
+#endif
+
+typedef struct {
+  uint32_t abi;
+  uint32_t fpccr;             // Lazy stacking configuration set by the startup code (FPU builds)
+  uint32_t samples;
+  uint32_t cycles;
+  uint32_t cycles_per_sample;
+  int32_t output_milli;       // Last filter output * 1000
+} BenchResult;
+
+volatile BenchResult bench_float;
+
+static uint16_t bench_raw[BENCH_SAMPLES];
+
+// Calibration polynomial, c0 + c1 * v + c2 * v^2 + c3 * v^3, volts to degrees Celsius
+static const float bench_coeffs[4] = { -40.0f, 62.5f, -1.75f, 0.125f };
+
+float benchScale(uint16_t raw);
+float benchKernel(void);
+
+int main(void) {
+  uint32_t seed = 12345;
+
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+    seed = seed * 1664525 + 1013904223;
+    bench_raw[i] = (uint16_t)(seed >> 20);      // 12 bits
+  }
+
+  dwtInit();
+
+  benchKernel();                // Warm up
+
+  uint32_t start = dwtCycles();
+  float output = benchKernel();
+  uint32_t cycles = dwtCycles() - start;
+
+  bench_float.abi = BENCH_ABI;
+#ifdef __ARM_FP
+  bench_float.fpccr = FPU->FPCCR;
+#endif
+  bench_float.samples = BENCH_SAMPLES * BENCH_PASSES;
+  bench_float.cycles = cycles;
+  bench_float.cycles_per_sample = cycles / (BENCH_SAMPLES * BENCH_PASSES);
+  bench_float.output_milli = (int32_t)(output * 1000.0f);
+
+  gpioPinWrite(GPIOA, 5, 1, NULL);
+
+  while (1) {}
+}
+
+float benchScale(uint16_t raw) {
+  float v = (float)raw * (3.3f / 4095.0f);
+
+  return bench_coeffs[0] + v * (bench_coeffs[1] + v * (bench_coeffs[2] + v * bench_coeffs[3]));
+}
+
+float benchKernel(void) {
+  const float alpha = 0.125f;
+  float y = 0.0f;
+
+  for (uint32_t pass = 0; pass < BENCH_PASSES; pass++) {
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+      y += alpha * (benchScale(bench_raw[i]) - y);
+    }
+  }
+
+  return y;
+}
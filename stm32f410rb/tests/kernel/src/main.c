@@ -0,0 +1,93 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       Kernel Context Switch Benchmark
+ *
+ * @details     This file contains a program that measures the cost of a context switch of the
+ *              preemptive kernel with the DWT cycle counter.
+ *
+ *              Two threads with the same priority take turns through kernelYield(). Right before
+ *              yielding, a thread stores the cycle counter; the other thread reads it again as
+ *              soon as it resumes. The difference covers the whole switch: kernelYield(), the
+ *              PendSV exception entry, the register save and restore and the exception return.
+ *              Samples where a SysTick interrupt hit in between are kept, so "max" shows them and
+ *              "min" is the cost of a clean switch.
+ *
+ *              The LED on PA5 turns on once BENCH_SAMPLES samples have been taken. The results are
+ *              read with the debugger (make ocd, then "print bench_switch" in gdb).
+ *
+ *              Expected cost (HSI 16 MHz, zero wait states, FLOAT_ABI=soft), counted from the
+ *              Cortex-M4 instruction timings since no board has run this build yet:
+ *
+ *              - Exception entry and return: 12 + 12 cycles.
+ *              - PendSV_ISR: about 40 cycles, 20 of them for the two 9-register STMDB/LDMIA.
+ *              - kernelYield() and kernelSchedule() built with -O0: the rest of "min".
+ *
+ *              Record the measured min, max and average here once it has been run.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "dwt.h"
+#include "kernel.h"
+
+#define CORE_CLK_HZ     (16000000U)     // HSI, clock after reset
+#define TICK_HZ         (1000U)
+#define BENCH_SAMPLES   (10000U)
+
+volatile DwtStats bench_switch = DWT_STATS_INIT;
+
+static volatile uint32_t bench_stamp;
+static volatile uint32_t bench_stamp_valid;
+
+void benchThread(void *arg);
+
+int main(void) {
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+
+  dwtInit();
+
+  kernelThreadCreate(benchThread, NULL, 1, 512);
+  kernelThreadCreate(benchThread, NULL, 1, 512);
+  kernelStart(CORE_CLK_HZ, TICK_HZ);
+
+  while (1) {}
+}
+
+void benchThread(void *arg) {
+  (void)arg;
+
+  while (bench_switch.samples < BENCH_SAMPLES) {
+    uint32_t now = dwtCycles();
+
+    if (bench_stamp_valid) dwtStatsAdd(&bench_switch, now - bench_stamp);
+
+    bench_stamp_valid = 1;
+    bench_stamp = dwtCycles();
+    kernelYield();
+  }
+
+  gpioPinWrite(GPIOA, 5, 1, NULL);
+}
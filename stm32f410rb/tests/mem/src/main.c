@@ -0,0 +1,184 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       Memory Routine Throughput Benchmark
+ *
+ * @details     This file contains a program that measures memcpy(), memmove() and memset() from the
+ *              driver library with the DWT cycle counter, for several sizes and alignments, next to
+ *              a plain byte loop as reference. memmove() is measured with overlapping blocks and
+ *              the destination above the source, so it takes the backward path.
+ *
+ *              The alignments are given as offsets from a word boundary of the destination and the
+ *              source (memset() only uses the destination offset):
+ *
+ *              - 0 / 0: both aligned, LDM/STM blocks.
+ *              - 1 / 1: same misalignment, aligned after the first 3 bytes.
+ *              - 0 / 1: aligned destination, unaligned source, LDR/STR words.
+ *              - 3 / 0: unaligned destination, aligned after the first byte with an unaligned
+ *                source.
+ *
+ *              Every result is checked against the reference. bench_cycles holds the cycles of
+ *              each call (without the cost of reading the counter) and bench_bytes_per_kcycle
+ *              the throughput. The LED on PA5 turns on when the benchmark ends, unless a check
+ *              failed. The results are read with the debugger (make ocd, then
+ *              "print bench_bytes_per_kcycle" in gdb).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "dwt.h"
+#include "mem.h"
+
+#define BENCH_SIZES     (5U)
+#define BENCH_ALIGNS    (4U)
+#define BENCH_MAX_SIZE  (1024U)
+#define BENCH_MARGIN    (16U)           // Room for the offsets and the memmove() overlap
+#define BENCH_OVERLAP   (8U)            // memmove() destination = source + 8
+
+typedef enum {
+  kBenchBytes = 0,
+  kBenchMemcpy,
+  kBenchMemmove,
+  kBenchMemset,
+  kBenchRoutines
+} BenchRoutine;
+
+static const uint32_t bench_sizes[BENCH_SIZES] = { 4, 16, 64, 256, 1024 };
+static const uint8_t bench_aligns[BENCH_ALIGNS][2] = { { 0, 0 }, { 1, 1 }, { 0, 1 }, { 3, 0 } };
+
+volatile uint32_t bench_cycles[kBenchRoutines][BENCH_SIZES][BENCH_ALIGNS];
+volatile uint32_t bench_bytes_per_kcycle[kBenchRoutines][BENCH_SIZES][BENCH_ALIGNS];
+volatile uint32_t bench_errors;
+
+static uint8_t bench_src[BENCH_MAX_SIZE + BENCH_MARGIN] __attribute__((aligned(4)));
+static uint8_t bench_dst[BENCH_MAX_SIZE + BENCH_MARGIN] __attribute__((aligned(4)));
+static uint8_t bench_ref[BENCH_MAX_SIZE + BENCH_MARGIN];
+
+void benchFill(void);
+uint32_t benchRun(BenchRoutine routine, uint32_t size, uint32_t dst_offset, uint32_t src_offset);
+void benchCheck(BenchRoutine routine, uint32_t size, uint32_t dst_offset, uint32_t src_offset);
+void benchByteCopy(uint8_t *dst, const uint8_t *src, uint32_t size);
+
+int main(void) {
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+
+  dwtInit();
+
+  uint32_t start = dwtCycles();
+  uint32_t overhead = dwtCycles() - start;
+
+  for (uint32_t routine = 0; routine < kBenchRoutines; routine++) {
+    for (uint32_t s = 0; s < BENCH_SIZES; s++) {
+      for (uint32_t a = 0; a < BENCH_ALIGNS; a++) {
+        uint32_t size = bench_sizes[s];
+        uint32_t cycles = benchRun(routine, size, bench_aligns[a][0], bench_aligns[a][1]);
+
+        cycles -= overhead;
+        bench_cycles[routine][s][a] = cycles;
+        bench_bytes_per_kcycle[routine][s][a] = size * 1000 / cycles;
+        benchCheck(routine, size, bench_aligns[a][0], bench_aligns[a][1]);
+      }
+    }
+  }
+
+  if (bench_errors == 0) gpioPinWrite(GPIOA, 5, 1, NULL);
+
+  while (1) {}
+}
+
+void benchFill(void) {
+  for (uint32_t i = 0; i < sizeof(bench_src); i++) {
+    bench_src[i] = (uint8_t)(i * 7 + 1);
+    bench_dst[i] = (uint8_t)~i;
+  }
+}
+
+uint32_t benchRun(BenchRoutine routine, uint32_t size, uint32_t dst_offset, uint32_t src_offset) {
+  uint8_t *dst = &bench_dst[dst_offset];
+  const uint8_t *src = &bench_src[src_offset];
+  uint32_t start;
+  uint32_t end;
+
+  benchFill();
+
+  // memmove() works inside a single buffer, with the destination above the source
+  if (routine == kBenchMemmove) {
+    src = &bench_dst[src_offset];
+    dst = &bench_dst[dst_offset + BENCH_OVERLAP];
+  }
+
+  switch (routine) {
+    case kBenchBytes:
+      start = dwtCycles();
+      benchByteCopy(dst, src, size);
+      end = dwtCycles();
+      break;
+    case kBenchMemcpy:
+      start = dwtCycles();
+      memcpy(dst, src, size);
+      end = dwtCycles();
+      break;
+    case kBenchMemmove:
+      start = dwtCycles();
+      memmove(dst, src, size);
+      end = dwtCycles();
+      break;
+    default:
+      start = dwtCycles();
+      memset(dst, 0xA5, size);
+      end = dwtCycles();
+      break;
+  }
+
+  return end - start;
+}
+
+void benchCheck(BenchRoutine routine, uint32_t size, uint32_t dst_offset, uint32_t src_offset) {
+  // Rebuild the expected destination byte by byte, including the bytes around the block
+  for (uint32_t i = 0; i < sizeof(bench_ref); i++) bench_ref[i] = (uint8_t)~i;
+
+  if (routine == kBenchMemmove) {
+    for (uint32_t i = size; i > 0; i--) {
+      bench_ref[dst_offset + BENCH_OVERLAP + i - 1] = bench_ref[src_offset + i - 1];
+    }
+  }
+  else {
+    for (uint32_t i = 0; i < size; i++) {
+      bench_ref[dst_offset + i] = (routine == kBenchMemset) ? 0xA5 : bench_src[src_offset + i];
+    }
+  }
+
+  for (uint32_t i = 0; i < sizeof(bench_ref); i++) {
+    if (bench_dst[i] != bench_ref[i]) {
+      bench_errors++;
+      return;
+    }
+  }
+}
+
+void benchByteCopy(uint8_t *dst, const uint8_t *src, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++) dst[i] = src[i];
+}
@@ -0,0 +1,131 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       Performance Profile Benchmark
+ *
+ * @details     This file contains a program that runs the same workload under each performance
+ *              profile and measures it with the DWT cycle counter.
+ *
+ *              The workload is a bitwise CRC-32 of the first 2 KB of flash (the vector table and
+ *              the start of the code), run from flash, so the cycle count depends on the flash wait
+ *              states and on how well the ART accelerator hides them, while the
+ *              time also depends on the clock frequency.
+ *
+ *              The energy is estimated as time * supply voltage * supply current. The current of
+ *              each profile defaults to the typical run mode IDD of the datasheet for its HCLK and
+ *              voltage scale (BENCH_IDD_TYP_UA). A current measured on the IDD jumper of the
+ *              Nucleo board while the workload runs can be set in BENCH_IDD_MEASURED_UA, and
+ *              replaces the datasheet value of its profile when it is not 0.
+ *
+ *              The LED on PA5 turns on when the benchmark ends. The results are read with the
+ *              debugger (make ocd, then "print bench_profiles" in gdb).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "dwt.h"
+#include "perf.h"
+
+#define BENCH_FLASH_START (0x08000000UL)
+#define BENCH_FLASH_WORDS (512U)        // 2 KB
+#define BENCH_PASSES      (4U)
+#define BENCH_SUPPLY_MV   (3300U)
+
+// Typical IDD in uA of each profile, indexed by PerfProfile. Datasheet DocID028094 Rev 6,
+// table 24: run mode from flash, ART accelerator on except prefetch, VDD = 3.6 V (the closest to
+// the 3.3 V of the Nucleo board), all peripherals disabled, TA = 25 C:
+// 100 MHz scale 1: 10.6 mA, 64 MHz scale 3: 6.2 mA, 16 MHz HSI scale 3: 1.7 mA
+#define BENCH_IDD_TYP_UA        { 10600, 6200, 1700 }
+
+// Supply current in uA measured on the IDD jumper for each profile, 0 to use the datasheet value
+#define BENCH_IDD_MEASURED_UA   { 0, 0, 0 }
+
+typedef struct {
+  uint32_t hclk_hz;
+  uint32_t cycles;
+  uint32_t time_us;
+  uint32_t idd_ua;
+  uint32_t idd_measured; // 1 if idd_ua was measured, 0 if it comes from the datasheet
+  uint32_t energy_uj;
+  uint32_t crc;          // Must be the same for every profile
+} BenchResult;
+
+volatile BenchResult bench_profiles[kPerfProfiles];
+
+static const uint32_t bench_idd_typ_ua[kPerfProfiles] = BENCH_IDD_TYP_UA;
+static const uint32_t bench_idd_measured_ua[kPerfProfiles] = BENCH_IDD_MEASURED_UA;
+
+uint32_t benchWorkload(void);
+
+int main(void) {
+  static const PerfProfile order[kPerfProfiles] = { kPerfLowPower, kPerfBalanced, kPerfMax };
+
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+
+  dwtInit();
+
+  for (uint32_t i = 0; i < kPerfProfiles; i++) {
+    PerfProfile profile = order[i];
+    volatile BenchResult *result = &bench_profiles[profile];
+
+    perfSetProfile(profile);
+    benchWorkload();            // Warm up the ART caches
+
+    uint32_t start = dwtCycles();
+    result->crc = benchWorkload();
+    result->cycles = dwtCycles() - start;
+
+    result->hclk_hz = perfHclkHz();
+    result->time_us = result->cycles / (result->hclk_hz / 1000000);
+    result->idd_measured = (bench_idd_measured_ua[profile] != 0);
+    result->idd_ua = result->idd_measured ? bench_idd_measured_ua[profile]
+                                          : bench_idd_typ_ua[profile];
+
+    // nC = us * uA / 10^3, then uJ = nC * mV / 10^6 (kept in 32 bits)
+    uint32_t charge_nc = result->time_us * result->idd_ua / 1000;
+    result->energy_uj = charge_nc * BENCH_SUPPLY_MV / 1000000;
+  }
+
+  perfSetProfile(kPerfLowPower);
+  gpioPinWrite(GPIOA, 5, 1, NULL);
+
+  while (1) {}
+}
+
+uint32_t benchWorkload(void) {
+  const volatile uint32_t *flash = (const volatile uint32_t *)BENCH_FLASH_START;
+  uint32_t crc = 0xFFFFFFFF;
+
+  for (uint32_t pass = 0; pass < BENCH_PASSES; pass++) {
+    for (uint32_t i = 0; i < BENCH_FLASH_WORDS; i++) {
+      crc ^= flash[i];
+      for (uint32_t bit = 0; bit < 32; bit++) {
+        crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+      }
+    }
+  }
+
+  return ~crc;
+}
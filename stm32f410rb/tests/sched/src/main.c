@@ -0,0 +1,100 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       Event Scheduler Test
+ *
+ * @details     This file contains a program that runs all of its work from the event scheduler
+ *              instead of polling in a superloop. The interrupt handlers only post events:
+ *
+ *              - The SysTick handler posts a tick to the blink task every TICK_MS milliseconds,
+ *                which toggles the LED on PA5 every BLINK_TICKS ticks.
+ *
+ *              - The EXTI handler of the user button (PC13) posts the press to the button task,
+ *                which has a higher priority, counts it and flips the blink rate.
+ *
+ *              Between events schedRun() sleeps in lpmIdle(). lpmInit() is not called, so it
+ *              always picks Sleep mode and SysTick keeps running. The counters are read with the
+ *              debugger (make ocd, then "print sched_presses" in gdb).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "sched.h"
+
+#define CORE_CLK_HZ     (16000000U)     // HSI, clock after reset
+#define TICK_MS         (10U)
+#define BLINK_TICKS     (50U)           // 500 ms, or 100 ms after a button press
+
+#define TASK_BUTTON     (0U)
+#define TASK_BLINK      (1U)
+
+volatile uint32_t sched_ticks;
+volatile uint32_t sched_presses;
+volatile uint32_t sched_dropped;        // Events lost because a queue was full
+
+static uint32_t blink_ticks = BLINK_TICKS;
+
+void buttonTask(uint32_t event);
+void blinkTask(uint32_t event);
+void buttonIsr(void);
+
+int main(void) {
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+  gpioPinSetup(GPIOC, 13, kModeInput);      // Pulled up on the board, low while pressed
+
+  schedTaskCreate(TASK_BUTTON, buttonTask);
+  schedTaskCreate(TASK_BLINK, blinkTask);
+
+  gpioInterruptSet(GPIOC, 13, 0, 2, buttonIsr);
+
+  nvicSetPriority(kIrqSysTick, 3);
+  SYSTICK->LOAD = CORE_CLK_HZ / 1000 * TICK_MS - 1;
+  SYSTICK->VAL = 0;
+  SYSTICK->CTRL = (1 << 2) | (1 << 1) | (1 << 0);   // Core clock, interrupt, enable
+
+  schedRun();
+}
+
+void Systick_ISR(void) {
+  if (schedPost(TASK_BLINK, 0)) sched_dropped++;
+}
+
+void buttonIsr(void) {
+  if (schedPost(TASK_BUTTON, 0)) sched_dropped++;
+}
+
+void buttonTask(uint32_t event) {
+  (void)event;
+
+  sched_presses++;
+  blink_ticks = (blink_ticks == BLINK_TICKS) ? BLINK_TICKS / 5 : BLINK_TICKS;
+}
+
+void blinkTask(uint32_t event) {
+  (void)event;
+
+  if (++sched_ticks % blink_ticks == 0) gpioPinToggle(GPIOA, 5, NULL);
+}
@@ -0,0 +1,99 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       Software Interrupt Latency Benchmark
+ *
+ * @details     This file contains a program that measures the latency of the software interrupts
+ *              with the DWT cycle counter, from the call to swiTrigger() to the first line of the
+ *              deferred handler.
+ *
+ *              - bench_thread: the main code triggers kSwi0, which preempts it right away. This
+ *                covers swiTrigger(), the exception entry and swiDispatch().
+ *
+ *              - bench_tail_chain: the SysTick handler, at a more urgent priority, triggers kSwi1
+ *                as its last action. The deferred handler only runs once SysTick returns, and
+ *                the NVIC tail-chains into it without restoring and saving the context again.
+ *
+ *              The LED on PA5 turns on when both measurements are done. The results are read with
+ *              the debugger (make ocd, then "print bench_thread" in gdb).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "dwt.h"
+#include "nvic.h"
+#include "swi.h"
+
+#define CORE_CLK_HZ     (16000000U)     // HSI, clock after reset
+#define TICK_HZ         (1000U)
+#define BENCH_SAMPLES   (1000U)
+
+volatile DwtStats bench_thread = DWT_STATS_INIT;
+volatile DwtStats bench_tail_chain = DWT_STATS_INIT;
+
+static volatile uint32_t bench_stamp;
+
+void benchDeferred(uint32_t events);
+
+int main(void) {
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+
+  dwtInit();
+
+  swiInit(kSwi0, 2, benchDeferred);
+  swiInit(kSwi1, 3, benchDeferred);
+
+  while (bench_thread.samples < BENCH_SAMPLES) {
+    uint32_t samples = bench_thread.samples;
+
+    bench_stamp = dwtCycles();
+    swiTrigger(kSwi0, 1);
+    while (bench_thread.samples == samples) {}    // The pend takes a few cycles to be taken
+  }
+
+  nvicSetPriority(kIrqSysTick, 1);
+  SYSTICK->LOAD = CORE_CLK_HZ / TICK_HZ - 1;
+  SYSTICK->VAL = 0;
+  SYSTICK->CTRL = (1 << 2) | (1 << 1) | (1 << 0);   // Core clock, interrupt, enable
+
+  while (bench_tail_chain.samples < BENCH_SAMPLES) {}
+
+  SYSTICK->CTRL = 0;
+  gpioPinWrite(GPIOA, 5, 1, NULL);
+
+  while (1) {}
+}
+
+void Systick_ISR(void) {
+  bench_stamp = dwtCycles();
+  swiTrigger(kSwi1, 2);
+}
+
+void benchDeferred(uint32_t events) {
+  uint32_t cycles = dwtCycles() - bench_stamp;
+
+  if (events & 1) dwtStatsAdd(&bench_thread, cycles);
+  if (events & 2) dwtStatsAdd(&bench_tail_chain, cycles);
+}
@@ -0,0 +1,133 @@
+/***************************************************************************************************
+ * @file        main.c
+ *
+ * @brief       Software Timer Tick Benchmark
+ *
+ * @details     This file contains a program that measures the cost of swtimerTick() against the
+ *              number of running timers with the DWT cycle counter.
+ *
+ *              For every entry of bench_tick, that many periodic timers are started with pseudo-
+ *              random periods between 1 and BENCH_MAX_PERIOD ticks, then BENCH_TICKS ticks are
+ *              run and timed one by one. swtimerTick() is called directly, so the figures leave
+ *              out the exception entry and exit of a real tick interrupt (12 cycles each on the
+ *              Cortex-M4 with zero wait states). The average grows with the number of timers
+ *              that expire per tick, not with the number of timers that are waiting, and the
+ *              maximum shows the ticks where a slot of an upper level was cascaded.
+ *
+ *              The cost of swtimerStart() plus swtimerStop() on a wheel holding BENCH_TIMERS
+ *              timers is stored in bench_start_stop.
+ *
+ *              The LED on PA5 turns on when the benchmark ends. The results are read with the
+ *              debugger (make ocd, then "print bench_tick" in gdb).
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32f410rb.h"
+#include "gpio.h"
+#include "dwt.h"
+#include "swtimer.h"
+
+#define BENCH_TIMERS      (512U)
+#define BENCH_TICKS       (8192U)
+#define BENCH_MAX_PERIOD  (5000U)
+#define BENCH_RUNS        (6U)
+
+typedef struct {
+  uint32_t timers;      // Running timers
+  uint32_t expired;     // Callbacks run during the BENCH_TICKS ticks
+  DwtStats cycles;      // Cycles per tick (per start and stop in bench_start_stop)
+} BenchResult;
+
+volatile BenchResult bench_tick[BENCH_RUNS] = {
+  { .timers = 0 }, { .timers = 1 }, { .timers = 16 },
+  { .timers = 64 }, { .timers = 256 }, { .timers = 512 }
+};
+volatile BenchResult bench_start_stop;
+
+static SwTimer bench_timers[BENCH_TIMERS];
+static volatile uint32_t bench_expired;
+static uint32_t bench_seed = 1;
+
+void benchCallback(void *arg);
+uint32_t benchRandom(void);
+
+int main(void) {
+  gpioPinSetup(GPIOA, 5, kModeOutput);
+
+  dwtInit();
+
+  for (uint32_t i = 0; i < BENCH_TIMERS; i++) {
+    swtimerInit(&bench_timers[i], benchCallback, NULL);
+  }
+
+  for (uint32_t run = 0; run < BENCH_RUNS; run++) {
+    dwtStatsReset(&bench_tick[run].cycles);
+
+    for (uint32_t i = 0; i < bench_tick[run].timers; i++) {
+      uint32_t period = 1 + benchRandom() % BENCH_MAX_PERIOD;
+      swtimerStart(&bench_timers[i], period, period);
+    }
+    bench_expired = 0;
+
+    for (uint32_t tick = 0; tick < BENCH_TICKS; tick++) {
+      uint32_t start = dwtCycles();
+      swtimerTick();
+      dwtStatsAdd(&bench_tick[run].cycles, dwtCycles() - start);
+    }
+
+    bench_tick[run].expired = bench_expired;
+
+    for (uint32_t i = 0; i < bench_tick[run].timers; i++) {
+      swtimerStop(&bench_timers[i]);
+    }
+  }
+
+  // Start/stop cost with a full wheel
+  for (uint32_t i = 1; i < BENCH_TIMERS; i++) {
+    swtimerStart(&bench_timers[i], 1 + benchRandom() % SWTIMER_MAX_TICKS, 0);
+  }
+  bench_start_stop.timers = BENCH_TIMERS;
+  dwtStatsReset(&bench_start_stop.cycles);
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t ticks = 1 + benchRandom() % SWTIMER_MAX_TICKS;
+    uint32_t start = dwtCycles();
+    swtimerStart(&bench_timers[0], ticks, 0);
+    swtimerStop(&bench_timers[0]);
+    dwtStatsAdd(&bench_start_stop.cycles, dwtCycles() - start);
+  }
+
+  gpioPinWrite(GPIOA, 5, 1, NULL);
+
+  while (1) {}
+}
+
+void benchCallback(void *arg) {
+  (void)arg;
+  bench_expired++;
+}
+
+uint32_t benchRandom(void) {
+  bench_seed = bench_seed * 1664525 + 1013904223;   // Numerical Recipes LCG
+  return bench_seed >> 8;
+}
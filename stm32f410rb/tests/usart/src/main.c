@@ -34,13 +34,13 @@
 #include <stdint.h>
 #include "stm32f410rb.h"
 
-#include "sysclk.h"
+#include "perf.h"
 #include "usart.h"
 
 
 /**************************************************************************************************/
 int main(void) {
-	set_system_clock();
+	perfSetProfile(kPerfBalanced);
 	usart1_init();
 
 	RCC->AHB1ENR |= (1 << 0);       // Enable clock for GPIOA
@@ -31,7 +31,8 @@
 #include <stddef.h>
 
 #include "stm32f410rb.h"
-#include "sysclk.h"
+#include "perf.h"
+#include "nvic.h"
 #include "usart.h"
 
 
@@ -55,15 +56,15 @@ void usart2_init(void) {
   USART2->CR1 = 0;    // Disable this USART
 
   unsigned long baud_rate = 9600;
-  USART2->BRR = APB1_FREQ / baud_rate;
+  USART2->BRR = perfApb1Hz() / baud_rate;
 
   USART2->CR1 |= (1 << 2);      // Usart receiver enable
   USART2->CR1 |= (1 << 3);      // Usart transmitter enable
 
   // Configure receiver interrupt
   USART2->CR1 |= (1 << 5);    // RXNEIE = 1: RXNE interrupt enabled
-  NVIC->ISER[1] |= (1 << 6);  // Enable interrupt for USART2 in NVIC
-  NVIC->IPR[38] |= (1 << 4);  // Set priority
+  nvicSetPriority(kIrqUsart2, 1);
+  nvicEnable(kIrqUsart2);     // Enable interrupt for USART2 in NVIC
 
   USART2->CR1 |= (1 << 13);   // Usart enable
 }
@@ -106,7 +107,7 @@ void usart1_init(void) {
 	USART1->CR1 = (0 << 13);    	// Usart disable
 
 	unsigned long baud_rate = 9600;
-	USART1->BRR = APB2_FREQ / baud_rate;
+	USART1->BRR = perfApb2Hz() / baud_rate;
 
 	USART1->CR1 |= (1 << 2);      // Usart receiver enable
 	USART1->CR1 |= (1 << 3);      // Usart transmitter enable
@@ -0,0 +1,237 @@
+/***************************************************************************************************
+ * @file        logdec.c
+ *
+ * @brief       Host tool that re-inflates tokenized log messages.
+ *
+ * @details     Reads the ".logfmt" section of the application ELF file (see drivers/include/log.h)
+ *              and decodes the byte stream captured from the USART, printing one line per message.
+ *              Bytes that do not start a valid message are skipped, so the decoder resynchronizes
+ *              on its own when the capture starts in the middle of a message.
+ *
+ *              Usage: logdec <final.elf> [capture.bin]   (reads stdin when no capture is given)
+ *
+ *              e.g. stty -F /dev/ttyACM0 raw 9600 && logdec build/final.elf < /dev/ttyACM0
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define LOG_MAX_ARGS        (4U)
+
+
+static char *strings;         // Contents of the .logfmt section
+static uint32_t strings_size;
+
+
+/**************************************************************************************************/
+static uint32_t readLe(const uint8_t *bytes, unsigned size) {
+  uint32_t value = 0;
+  for (unsigned i = 0; i < size; i++) value |= (uint32_t)bytes[i] << (8 * i);
+  return value;
+}
+
+
+/***************************************************************************************************
+ * @brief       Loads the .logfmt section of a little-endian ELF32 file.
+ */
+static int loadStrings(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    perror(path);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *elf = malloc((size_t)size);
+  if (!elf || fread(elf, 1, (size_t)size, file) != (size_t)size) {
+    fclose(file);
+    free(elf);
+    return 1;
+  }
+  fclose(file);
+
+  if (size < 52 || memcmp(elf, "\177ELF", 4) != 0 || elf[4] != 1 || elf[5] != 1) {
+    fprintf(stderr, "%s: not a little-endian ELF32 file\n", path);
+    free(elf);
+    return 1;
+  }
+
+  uint32_t shoff = readLe(elf + 32, 4);
+  uint32_t shentsize = readLe(elf + 46, 2);
+  uint32_t shnum = readLe(elf + 48, 2);
+  uint32_t shstrndx = readLe(elf + 50, 2);
+  if (shoff + (uint64_t)shnum * shentsize > (uint64_t)size || shstrndx >= shnum) {
+    fprintf(stderr, "%s: bad section header table\n", path);
+    free(elf);
+    return 1;
+  }
+  const uint8_t *names = elf + readLe(elf + shoff + shstrndx * shentsize + 16, 4);
+
+  for (uint32_t i = 0; i < shnum; i++) {
+    const uint8_t *section = elf + shoff + i * shentsize;
+    if (strcmp((const char *)names + readLe(section, 4), ".logfmt") != 0) continue;
+
+    uint32_t offset = readLe(section + 16, 4);
+    strings_size = readLe(section + 20, 4);
+    if (offset + (uint64_t)strings_size > (uint64_t)size) break;
+    strings = malloc(strings_size + 1);
+    memcpy(strings, elf + offset, strings_size);
+    strings[strings_size] = '\0';
+    free(elf);
+    return 0;
+  }
+
+  fprintf(stderr, "%s: no .logfmt section\n", path);
+  free(elf);
+  return 1;
+}
+
+
+/***************************************************************************************************
+ * @brief       Prints a format string with raw 32-bit arguments.
+ *
+ * @details     Every conversion is handed to printf separately, after replacing its length
+ *              modifier by the one matching the 32-bit argument type.
+ */
+static void printMessage(const char *format, const uint32_t *args, uint32_t nargs) {
+  uint32_t next = 0;
+
+  for (const char *c = format; *c; c++) {
+    if (*c != '%') {
+      putchar(*c);
+      continue;
+    }
+    if (c[1] == '%') {
+      putchar('%');
+      c++;
+      continue;
+    }
+
+    char spec[32] = "%";
+    size_t length = 1;
+    for (c++; *c && strchr("-+ #0123456789.", *c) && length < sizeof(spec) - 4; c++) {
+      spec[length++] = *c;
+    }
+    while (*c && strchr("hlLqjzt", *c)) c++;
+    if (!*c) break;
+
+    if (next >= nargs) {
+      printf("<missing>");
+      continue;
+    }
+    uint32_t arg = args[next++];
+    spec[length++] = *c;
+    spec[length] = '\0';
+
+    switch (*c) {
+      case 'd':
+      case 'i':
+        printf(spec, (int)(int32_t)arg);
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+      case 'c':
+        printf(spec, (unsigned)arg);
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G': {
+        float value;
+        memcpy(&value, &arg, sizeof(value));
+        printf(spec, (double)value);
+        break;
+      }
+      case 'p':
+        printf("0x%08x", (unsigned)arg);
+        break;
+      default:
+        printf("<%%%c 0x%08x>", *c, (unsigned)arg);
+        break;
+    }
+  }
+  putchar('\n');
+}
+
+
+/**************************************************************************************************/
+int main(int argc, char **argv) {
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "Usage: %s <final.elf> [capture.bin]\n", argv[0]);
+    return 1;
+  }
+  if (loadStrings(argv[1])) return 1;
+
+  FILE *input = stdin;
+  if (argc == 3) {
+    input = fopen(argv[2], "rb");
+    if (!input) {
+      perror(argv[2]);
+      return 1;
+    }
+  }
+
+  // Sliding window over the stream, a message is at most 1 + LOG_MAX_ARGS words long
+  uint8_t window[4 * (1 + LOG_MAX_ARGS)];
+  size_t filled = 0;
+  unsigned long skipped = 0;
+  int byte;
+
+  while ((byte = fgetc(input)) != EOF) {
+    window[filled++] = (uint8_t)byte;
+    if (filled < 4) continue;
+
+    uint32_t header = readLe(window, 4);
+    uint32_t nargs = (header >> 24) & 0x0F;
+    uint32_t token = header & 0x00FFFFFF;
+    int valid = ((header >> 28) == 0xA) && nargs <= LOG_MAX_ARGS && token < strings_size &&
+                (token == 0 || strings[token - 1] == '\0');
+
+    if (!valid) {
+      memmove(window, window + 1, --filled);
+      skipped++;
+      continue;
+    }
+    if (filled < 4 * (1 + nargs)) continue;
+
+    uint32_t args[LOG_MAX_ARGS];
+    for (uint32_t i = 0; i < nargs; i++) args[i] = readLe(window + 4 * (1 + i), 4);
+    printMessage(strings + token, args, nargs);
+    fflush(stdout);
+    filled = 0;
+  }
+
+  if (input != stdin) fclose(input);
+  if (skipped) fprintf(stderr, "%lu bytes skipped while resynchronizing\n", skipped);
+  free(strings);
+  return 0;
+}
@@ -0,0 +1,208 @@
+/***************************************************************************************************
+ * @file        profmap.c
+ *
+ * @brief       Host tool that maps a profiler histogram to function names.
+ *
+ * @details     Reads a histogram dumped by the on-target profiler (see drivers/include/prof.h)
+ *              and the linker map file of the same application (build/final.map), attributes
+ *              every bin to the symbol that contains the middle address of the bin and prints the
+ *              functions sorted by number of samples.
+ *
+ *              Usage: profmap <build/final.map> <prof.bin>
+ *
+ * @note        Only global symbols appear in the linker map. Samples taken in static functions
+ *              are attributed to the closest preceding global symbol.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define PROF_MAGIC          (0x464F5250UL)
+#define PROF_HEADER_SIZE    (20U)
+#define MAX_NAME            (128U)
+
+
+typedef struct {
+  uint32_t address;
+  char name[MAX_NAME];
+  uint32_t samples;
+} Symbol;
+
+
+static Symbol *symbols;
+static size_t symbol_count;
+
+
+/**************************************************************************************************/
+static uint32_t readLe(const uint8_t *bytes, unsigned size) {
+  uint32_t value = 0;
+  for (unsigned i = 0; i < size; i++) value |= (uint32_t)bytes[i] << (8 * i);
+  return value;
+}
+
+
+/**************************************************************************************************/
+static int isIdentifier(const char *name) {
+  if (!(isalpha((unsigned char)name[0]) || name[0] == '_')) return 0;
+  for (const char *c = name; *c; c++) {
+    if (!(isalnum((unsigned char)*c) || *c == '_')) return 0;
+  }
+  return 1;
+}
+
+
+/**************************************************************************************************/
+static int compareAddress(const void *a, const void *b) {
+  const Symbol *sa = a, *sb = b;
+  return (sa->address > sb->address) - (sa->address < sb->address);
+}
+
+
+/**************************************************************************************************/
+static int compareSamples(const void *a, const void *b) {
+  const Symbol *sa = a, *sb = b;
+  return (sa->samples < sb->samples) - (sa->samples > sb->samples);
+}
+
+
+/***************************************************************************************************
+ * @brief       Collects the symbol definitions of a GNU ld map file.
+ *
+ * @details     Symbol lines have exactly two fields, "0x<address> <name>". Input section lines
+ *              (address, size, object) and assignments ("_etext = .") are skipped.
+ */
+static int loadMap(const char *path) {
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    perror(path);
+    return 1;
+  }
+
+  size_t capacity = 0;
+  char line[512];
+  while (fgets(line, sizeof(line), file)) {
+    char address[64], name[MAX_NAME], extra[8];
+    if (!isspace((unsigned char)line[0])) continue;
+    if (sscanf(line, " %63s %127s %7s", address, name, extra) != 2) continue;
+    if (strncmp(address, "0x", 2) != 0 || !isIdentifier(name)) continue;
+
+    if (symbol_count == capacity) {
+      capacity = capacity ? capacity * 2 : 256;
+      symbols = realloc(symbols, capacity * sizeof(Symbol));
+      if (!symbols) {
+        fclose(file);
+        return 1;
+      }
+    }
+    symbols[symbol_count].address = (uint32_t)strtoul(address, NULL, 16);
+    snprintf(symbols[symbol_count].name, MAX_NAME, "%s", name);
+    symbols[symbol_count].samples = 0;
+    symbol_count++;
+  }
+
+  fclose(file);
+  qsort(symbols, symbol_count, sizeof(Symbol), compareAddress);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+static Symbol *findSymbol(uint32_t address) {
+  Symbol *found = NULL;
+  size_t low = 0, high = symbol_count;
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    if (symbols[mid].address <= address) {
+      found = &symbols[mid];
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return found;
+}
+
+
+/**************************************************************************************************/
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <final.map> <prof.bin>\n", argv[0]);
+    return 1;
+  }
+  if (loadMap(argv[1])) return 1;
+
+  FILE *file = fopen(argv[2], "rb");
+  if (!file) {
+    perror(argv[2]);
+    return 1;
+  }
+  uint8_t header[PROF_HEADER_SIZE];
+  if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+      readLe(header, 4) != PROF_MAGIC) {
+    fprintf(stderr, "%s: not a profiler dump\n", argv[2]);
+    fclose(file);
+    return 1;
+  }
+
+  uint32_t base = readLe(header + 4, 4);
+  uint32_t shift = readLe(header + 8, 2);
+  uint32_t bins = readLe(header + 10, 2);
+  uint32_t samples = readLe(header + 12, 4);
+  uint32_t outside = readLe(header + 16, 4);
+  uint32_t unknown = 0;
+
+  for (uint32_t i = 0; i < bins; i++) {
+    uint8_t count[2];
+    if (fread(count, 1, 2, file) != 2) {
+      fprintf(stderr, "%s: truncated dump (%u of %u bins)\n", argv[2], i, bins);
+      break;
+    }
+    Symbol *symbol = findSymbol(base + (i << shift) + ((1U << shift) >> 1));
+    if (symbol) {
+      symbol->samples += readLe(count, 2);
+    } else {
+      unknown += readLe(count, 2);
+    }
+  }
+  fclose(file);
+
+  qsort(symbols, symbol_count, sizeof(Symbol), compareSamples);
+
+  printf("%u samples, bin width %u bytes, %u outside of FLASH\n\n", samples, 1U << shift, outside);
+  printf("%10s %8s  %s\n", "samples", "percent", "function");
+  for (size_t i = 0; i < symbol_count && symbols[i].samples; i++) {
+    printf("%10u %7.2f%%  %s\n", symbols[i].samples,
+           samples ? 100.0 * symbols[i].samples / samples : 0.0, symbols[i].name);
+  }
+  if (unknown) {
+    printf("%10u %7.2f%%  %s\n", unknown, samples ? 100.0 * unknown / samples : 0.0, "(unknown)");
+  }
+
+  free(symbols);
+  return 0;
+}
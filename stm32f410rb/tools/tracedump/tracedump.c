@@ -0,0 +1,211 @@
+/***************************************************************************************************
+ * @file        tracedump.c
+ *
+ * @brief       Host tool that converts a trace buffer dump into a Chrome/Perfetto timeline.
+ *
+ * @details     Reads a buffer dumped by the on-target trace recorder (see drivers/include/trace.h)
+ *              and writes a JSON file in the Chrome Trace Event format, which can be opened with
+ *              chrome://tracing or https://ui.perfetto.dev.
+ *
+ *              - Interrupt entry/exit records become duration slices on the "isr" track.
+ *              - Markers become instant events on the "main" track.
+ *              - Queue records become counter tracks showing the depth of every queue.
+ *
+ *              Usage: tracedump [-f cpu_hz] [-n names.txt] <trace.bin> [timeline.json]
+ *
+ *              The optional names file has one "<isr|marker|queue> <id> <name>" entry per line.
+ *
+ * @author      Hiram Montejano Gómez (hiram.montejano.gomez@gmail.com)
+ *
+ * @date        Last Updated:   18/10/2026
+ *
+ * @copyright   This file is part of the "STM32F10RB Microcontroller Applications" project.
+ *
+ *              Every file is free software: you can redistribute it and/or modify
+ *              it under the terms of the GNU General Public License as published by
+ *              the Free Software Foundation, either version 3 of the License, or
+ *              (at your option) any later version.
+ *
+ *              These files are distributed in the hope that they will be useful,
+ *              but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *              MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *              GNU General Public License for more details.
+ *
+ *              You should have received a copy of the GNU General Public License
+ *              along with the "STM32F10RB Microcontroller Applications" project. If not,
+ *              see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define TRACE_MAGIC         (0x45435254UL)
+#define TRACE_HEADER_SIZE   (16U)
+#define TRACE_RECORD_SIZE   (8U)
+#define MAX_NAME            (64U)
+
+enum { kTraceIsrEnter, kTraceIsrExit, kTraceMarker, kTraceQueuePut, kTraceQueueGet };
+enum { kNameIsr, kNameMarker, kNameQueue, kNameKinds };
+
+
+static char names[kNameKinds][256][MAX_NAME];
+
+
+/**************************************************************************************************/
+static uint32_t readLe(const uint8_t *bytes, unsigned size) {
+  uint32_t value = 0;
+  for (unsigned i = 0; i < size; i++) value |= (uint32_t)bytes[i] << (8 * i);
+  return value;
+}
+
+
+/***************************************************************************************************
+ * @brief       Fills the name tables with defaults and overrides them from a names file.
+ */
+static int loadNames(const char *path) {
+  static const char *kDefaults[kNameKinds] = {"irq %u", "marker %u", "queue %u"};
+  for (int kind = 0; kind < kNameKinds; kind++) {
+    for (unsigned id = 0; id < 256; id++) snprintf(names[kind][id], MAX_NAME, kDefaults[kind], id);
+  }
+  if (!path) return 0;
+
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    perror(path);
+    return 1;
+  }
+  char line[256], kind[16], name[MAX_NAME];
+  unsigned id;
+  while (fgets(line, sizeof(line), file)) {
+    if (sscanf(line, "%15s %u %63s", kind, &id, name) != 3 || id > 255) continue;
+    if (strcmp(kind, "isr") == 0) snprintf(names[kNameIsr][id], MAX_NAME, "%s", name);
+    else if (strcmp(kind, "marker") == 0) snprintf(names[kNameMarker][id], MAX_NAME, "%s", name);
+    else if (strcmp(kind, "queue") == 0) snprintf(names[kNameQueue][id], MAX_NAME, "%s", name);
+  }
+  fclose(file);
+  return 0;
+}
+
+
+/**************************************************************************************************/
+static void usage(const char *program) {
+  fprintf(stderr, "Usage: %s [-f cpu_hz] [-n names.txt] <trace.bin> [timeline.json]\n", program);
+}
+
+
+/**************************************************************************************************/
+int main(int argc, char **argv) {
+  double cpu_hz = 16000000.0;   // HSI, the clock after reset
+  const char *names_path = NULL;
+  int arg = 1;
+
+  for (; arg < argc && argv[arg][0] == '-'; arg++) {
+    if (strcmp(argv[arg], "-f") == 0 && arg + 1 < argc) {
+      cpu_hz = strtod(argv[++arg], NULL);
+    } else if (strcmp(argv[arg], "-n") == 0 && arg + 1 < argc) {
+      names_path = argv[++arg];
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (arg >= argc || cpu_hz <= 0) {
+    usage(argv[0]);
+    return 1;
+  }
+  if (loadNames(names_path)) return 1;
+
+  FILE *input = fopen(argv[arg], "rb");
+  if (!input) {
+    perror(argv[arg]);
+    return 1;
+  }
+  FILE *output = stdout;
+  if (arg + 1 < argc) {
+    output = fopen(argv[arg + 1], "w");
+    if (!output) {
+      perror(argv[arg + 1]);
+      fclose(input);
+      return 1;
+    }
+  }
+
+  uint8_t header[TRACE_HEADER_SIZE];
+  if (fread(header, 1, sizeof(header), input) != sizeof(header) ||
+      readLe(header, 4) != TRACE_MAGIC) {
+    fprintf(stderr, "%s: not a trace dump\n", argv[arg]);
+    return 1;
+  }
+  uint32_t head = readLe(header + 4, 4);
+  uint32_t size = readLe(header + 8, 4);
+  if (size == 0 || (size & (size - 1))) {
+    fprintf(stderr, "%s: bad ring size %u\n", argv[arg], size);
+    return 1;
+  }
+
+  uint8_t *ring = malloc((size_t)size * TRACE_RECORD_SIZE);
+  if (!ring || fread(ring, TRACE_RECORD_SIZE, size, input) != size) {
+    fprintf(stderr, "%s: truncated dump\n", argv[arg]);
+    return 1;
+  }
+  fclose(input);
+
+  // Oldest record still in the ring
+  uint32_t count = head < size ? head : size;
+  uint32_t first = head - count;
+
+  fprintf(output, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+  fprintf(output, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,"
+                  "\"args\":{\"name\":\"main\"}},\n");
+  fprintf(output, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,"
+                  "\"args\":{\"name\":\"isr\"}}");
+
+  // Timestamps are unwrapped with signed 32-bit deltas, which also absorbs the small reordering
+  // caused by an interrupt recording between the slot claim and the timestamp read.
+  uint64_t cycles = 0;
+  uint32_t previous = 0;
+  for (uint32_t n = 0; n < count; n++) {
+    const uint8_t *record = ring + (size_t)((first + n) & (size - 1)) * TRACE_RECORD_SIZE;
+    uint32_t stamp = readLe(record, 4);
+    unsigned type = record[4];
+    unsigned id = record[5];
+    unsigned value = readLe(record + 6, 2);
+
+    cycles = n == 0 ? stamp : (uint64_t)((int64_t)cycles + (int32_t)(stamp - previous));
+    previous = stamp;
+    double us = (double)cycles * 1e6 / cpu_hz;
+
+    switch (type) {
+      case kTraceIsrEnter:
+      case kTraceIsrExit:
+        fprintf(output, ",\n{\"name\":\"%s\",\"cat\":\"isr\",\"ph\":\"%s\",\"ts\":%.3f,"
+                        "\"pid\":0,\"tid\":1}",
+                names[kNameIsr][id], type == kTraceIsrEnter ? "B" : "E", us);
+        break;
+      case kTraceMarker:
+        fprintf(output, ",\n{\"name\":\"%s\",\"cat\":\"marker\",\"ph\":\"i\",\"s\":\"t\","
+                        "\"ts\":%.3f,\"pid\":0,\"tid\":0,\"args\":{\"value\":%u}}",
+                names[kNameMarker][id], us, value);
+        break;
+      case kTraceQueuePut:
+      case kTraceQueueGet:
+        fprintf(output, ",\n{\"name\":\"%s\",\"cat\":\"queue\",\"ph\":\"C\",\"ts\":%.3f,"
+                        "\"pid\":0,\"args\":{\"depth\":%u}}",
+                names[kNameQueue][id], us, value);
+        break;
+      default:
+        fprintf(stderr, "record %u: unknown type %u\n", first + n, type);
+        break;
+    }
+  }
+  fprintf(output, "\n]}\n");
+
+  free(ring);
+  if (output != stdout) fclose(output);
+  fprintf(stderr, "%u records (%u lost to overwrite)\n", count, head - count);
+  return 0;
+}
@@ -5,6 +5,11 @@
  *                      connected in PE0 and, while it is pressed, the LED whil turn on and off
  *                      faster.
  *
+ *                      The pins are accessed through the masked GPIODATA aperture (gpio.h). At
+ *                      startup the app measures the cycles of setting and clearing PE1 with
+ *                      GPIODATA |= and &= against GPIO_SET() and GPIO_CLEAR(), with the DWT
+ *                      cycle counter ("print bench_gpio" in gdb).
+ *
  * @AUTHOR:             Hiram Montejano Gómez
  * 
  * @STARTING DATE:      10/08/2021
@@ -13,28 +18,44 @@
  */
 
 #include <TM4C123GH6PM.h>
+#include "gpio.h"
+
+#define LED             GPIO_PIN(1)     /* PE1 */
+#define BUTTON          GPIO_PIN(0)     /* PE0 */
+#define BENCH_PULSES    1000
+
+typedef struct
+{
+  uint32_t loop_cycles;                 /* Empty loop, subtracted from the others */
+  uint32_t rmw_cycles;                  /* GPIODATA |= LED, then GPIODATA &= ~LED */
+  uint32_t masked_cycles;               /* GPIO_SET(), then GPIO_CLEAR() */
+} BenchGpio;
 
 void PortE_Init(void);
+void Bench_GPIO(void);
 void delayms(int milisec);
 
+volatile BenchGpio bench_gpio;          /* Cycles per pulse (a set and a clear) */
+
 int main(void)
 {
   PortE_Init();
+  Bench_GPIO();
 
   while(1)
   {
-    while(!(GPIOE->DATA & (1)))
+    while(!GPIO_READ(GPIOE, BUTTON))
     {
-      GPIOE->DATA |= (1<<1);
+      GPIO_SET(GPIOE, LED);
       delayms(200);
-      GPIOE->DATA &= ~(1<<1);
+      GPIO_CLEAR(GPIOE, LED);
       delayms(200);
     }
-    while(GPIOE->DATA & (1))
+    while(GPIO_READ(GPIOE, BUTTON))
     {
-      GPIOE->DATA |= (1<<1);
+      GPIO_SET(GPIOE, LED);
       delayms(50);
-      GPIOE->DATA &= ~(1<<1);
+      GPIO_CLEAR(GPIOE, LED);
       delayms(50);
     }
   }
@@ -57,6 +78,45 @@ void PortE_Init(void)
   GPIOE->DEN |= 0x03;
 }
 
+void Bench_GPIO(void)
+/*
+ * @BRIEF:            Measures the cycles of BENCH_PULSES pulses on the LED with each method
+ *
+ * @ARGUMENTS:        None
+ *
+ * @RETURNS:          None
+ */
+{
+  uint32_t start;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     // Enable the DWT
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  start = DWT->CYCCNT;
+  for(uint32_t i = 0; i < BENCH_PULSES; i++)
+  {
+    __NOP();
+  }
+  bench_gpio.loop_cycles = (DWT->CYCCNT - start) / BENCH_PULSES;
+
+  start = DWT->CYCCNT;
+  for(uint32_t i = 0; i < BENCH_PULSES; i++)
+  {
+    GPIOE->DATA |= LED;
+    GPIOE->DATA &= ~LED;
+  }
+  bench_gpio.rmw_cycles = (DWT->CYCCNT - start) / BENCH_PULSES - bench_gpio.loop_cycles;
+
+  start = DWT->CYCCNT;
+  for(uint32_t i = 0; i < BENCH_PULSES; i++)
+  {
+    GPIO_SET(GPIOE, LED);
+    GPIO_CLEAR(GPIOE, LED);
+  }
+  bench_gpio.masked_cycles = (DWT->CYCCNT - start) / BENCH_PULSES - bench_gpio.loop_cycles;
+}
+
 void delayms(int milisec)
 /*
  * @BRIEF:            Generates a delay for a set amount of time
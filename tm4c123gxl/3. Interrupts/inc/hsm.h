@@ -0,0 +1,85 @@
+/*
+ * @FILENAME:           hsm.h
+ *
+ * @DESCRIPTION:        Hierarchical event-driven state machine framework.
+ *
+ *                      - A state is a handler function plus a pointer to its parent state.
+ *                        Events a state does not handle bubble up to its parent.
+ *                      - Transitions run the exit actions from the current state up to the
+ *                        common ancestor, then the entry actions down to the target state.
+ *                      - Every machine owns an event queue. hsmPost() can be called from
+ *                        interrupt handlers, events are dispatched one at a time (run to
+ *                        completion) by hsmRun(), which sleeps (WFI) while every queue is empty.
+ *                      - Timers post an event to their machine when they expire. They are
+ *                        driven by SysTick, which only runs while a timer is armed.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _HSM_H_
+#define _HSM_H_
+
+#include <stdint.h>
+
+#define HSM_QUEUE_SIZE    8       /* Events per machine, must be a power of two             */
+#define HSM_MAX_DEPTH     8       /* Maximum nesting depth of the states                    */
+#define HSM_MAX_TIMERS    4       /* Maximum number of armed timers                         */
+#define HSM_TICK_HZ       1000    /* SysTick rate while a timer is armed (timer resolution) */
+
+/* Reserved signals, application signals start at HSM_USER_SIG */
+enum
+{
+  HSM_ENTRY_SIG = 0,
+  HSM_EXIT_SIG,
+  HSM_USER_SIG
+};
+
+/* Values returned by the state handlers */
+enum
+{
+  HSM_HANDLED = 0,        /* Event consumed                                   */
+  HSM_UNHANDLED,          /* Event passed to the parent state                 */
+  HSM_TRANSITION          /* Event consumed, transition to me->target         */
+};
+
+typedef struct Hsm Hsm;
+typedef struct HsmState HsmState;
+
+typedef int (*HsmHandler)(Hsm *me, uint8_t sig);
+
+struct HsmState
+{
+  const HsmState *parent;           /* NULL for top level states */
+  HsmHandler handler;
+};
+
+struct Hsm
+{
+  const HsmState *state;            /* Current (innermost) state */
+  const HsmState *target;           /* Set by HSM_TRAN()         */
+  uint8_t queue[HSM_QUEUE_SIZE];
+  volatile uint8_t head;
+  volatile uint8_t tail;
+};
+
+typedef struct
+{
+  Hsm *owner;
+  uint8_t sig;
+  uint32_t remaining;               /* Ticks left, 0 when disarmed */
+} HsmTimer;
+
+/* Requests a transition from a state handler: return HSM_TRAN(me, &state); */
+#define HSM_TRAN(me, target_state)  ((me)->target = (target_state), HSM_TRANSITION)
+
+void hsmInit(Hsm *me, const HsmState *initial);
+int hsmPost(Hsm *me, uint8_t sig);
+void hsmRun(Hsm *const machines[], unsigned int count);
+int hsmTimerArm(HsmTimer *timer, Hsm *owner, uint8_t sig, uint32_t milisec);
+void hsmTimerDisarm(HsmTimer *timer);
+
+#endif
@@ -1,6 +0,0 @@
-#ifndef _SYSTICK_TIMER_H_
-#define _SYSTICK_TIMER_H_
-
-void delayms(int milisec);
-
-#endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+/*
+ * @FILENAME:           hsm.c
+ *
+ * @DESCRIPTION:        Hierarchical event-driven state machine framework (see hsm.h).
+ *
+ *                      Queues and timers are shared with interrupt handlers, so they are only
+ *                      modified with interrupts masked. State handlers always run with
+ *                      interrupts enabled, from hsmRun().
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#include <stddef.h>
+#include "TM4C123GH6PM.h"
+#include "hsm.h"
+
+static HsmTimer *armed_timers[HSM_MAX_TIMERS];
+
+static void hsmTransition(Hsm *me, const HsmState *target)
+/*
+ * @BRIEF:          Runs the exit actions from the current state up to the common ancestor with
+ *                  the target, then the entry actions from there down to the target.
+ *                  A transition to the current state (or one of its ancestors) exits and
+ *                  re-enters that state.
+ *
+ * @ARGUMENTS:      Hsm *me:                  State machine
+ *                  const HsmState *target:   New state
+ *
+ * @RETURNS:        None
+ */
+{
+  const HsmState *path[HSM_MAX_DEPTH];
+  unsigned int depth = 0;
+  unsigned int common;
+
+  for (const HsmState *s = target; (s != NULL) && (depth < HSM_MAX_DEPTH); s = s->parent)
+  {
+    path[depth++] = s;      /* path[0] is the target, path[depth - 1] its top level state */
+  }
+
+  common = depth;
+  for (const HsmState *s = me->state; s != NULL; s = s->parent)
+  {
+    for (unsigned int i = 1; i < depth; i++)      /* Strict ancestors of the target only */
+    {
+      if (path[i] == s) {common = i;}
+    }
+    if (common < depth) {break;}
+
+    s->handler(me, HSM_EXIT_SIG);
+  }
+
+  for (unsigned int i = common; i > 0; i--)
+  {
+    path[i - 1]->handler(me, HSM_ENTRY_SIG);
+  }
+
+  me->state = target;
+}
+
+static void hsmDispatch(Hsm *me, uint8_t sig)
+/*
+ * @BRIEF:          Passes an event to the current state and then to its ancestors, until one of
+ *                  them handles it.
+ *
+ * @ARGUMENTS:      Hsm *me:        State machine
+ *                  uint8_t sig:    Event
+ *
+ * @RETURNS:        None
+ */
+{
+  int result = HSM_UNHANDLED;
+
+  for (const HsmState *s = me->state; (s != NULL) && (result == HSM_UNHANDLED); s = s->parent)
+  {
+    result = s->handler(me, sig);
+  }
+
+  if (result == HSM_TRANSITION) {hsmTransition(me, me->target);}
+}
+
+void hsmInit(Hsm *me, const HsmState *initial)
+/*
+ * @BRIEF:          Empties the event queue and enters the initial state (running the entry
+ *                  actions of all its ancestors first).
+ *
+ * @ARGUMENTS:      Hsm *me:                  State machine
+ *                  const HsmState *initial:  Initial state
+ *
+ * @RETURNS:        None
+ */
+{
+  me->head = 0;
+  me->tail = 0;
+  me->state = NULL;
+  hsmTransition(me, initial);
+}
+
+int hsmPost(Hsm *me, uint8_t sig)
+/*
+ * @BRIEF:          Queues an event. Can be called from interrupt handlers.
+ *
+ * @ARGUMENTS:      Hsm *me:        State machine
+ *                  uint8_t sig:    Event
+ *
+ * @RETURNS:        0 if queued, 1 if the queue was full (the event is lost)
+ */
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((uint8_t)(me->head - me->tail) >= HSM_QUEUE_SIZE)
+  {
+    __set_PRIMASK(primask);
+    return 1;
+  }
+  me->queue[me->head & (HSM_QUEUE_SIZE - 1)] = sig;
+  me->head++;
+
+  __set_PRIMASK(primask);
+  return 0;
+}
+
+void hsmRun(Hsm *const machines[], unsigned int count)
+/*
+ * @BRIEF:          Dispatches events forever. Machines earlier in the array have priority.
+ *                  The queues are checked with interrupts masked and the CPU sleeps right there
+ *                  if all of them are empty: a pending interrupt still wakes it up and is
+ *                  serviced as soon as interrupts are unmasked, so no event is left waiting.
+ *
+ * @ARGUMENTS:      Hsm *const machines[]:    State machines
+ *                  unsigned int count:       Number of state machines
+ *
+ * @RETURNS:        Never
+ */
+{
+  while(1)
+  {
+    Hsm *me = NULL;
+    uint8_t sig;
+
+    __disable_irq();
+    for (unsigned int i = 0; (i < count) && (me == NULL); i++)
+    {
+      if (machines[i]->head != machines[i]->tail) {me = machines[i];}
+    }
+
+    if (me == NULL)
+    {
+      __WFI();
+      __enable_irq();
+      continue;
+    }
+
+    sig = me->queue[me->tail & (HSM_QUEUE_SIZE - 1)];
+    me->tail++;
+    __enable_irq();
+
+    hsmDispatch(me, sig);
+  }
+}
+
+int hsmTimerArm(HsmTimer *timer, Hsm *owner, uint8_t sig, uint32_t milisec)
+/*
+ * @BRIEF:          Posts "sig" to "owner" after "milisec" miliseconds (one tick of resolution).
+ *                  Re-arms the timer if it was already armed.
+ *
+ * @ARGUMENTS:      HsmTimer *timer:      Timer
+ *                  Hsm *owner:           State machine that receives the event
+ *                  uint8_t sig:          Event
+ *                  uint32_t milisec:     Delay
+ *
+ * @RETURNS:        0 if armed, 1 if HSM_MAX_TIMERS timers were already armed
+ */
+{
+  int slot = -1;
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (int i = 0; i < HSM_MAX_TIMERS; i++)
+  {
+    if (armed_timers[i] == timer) {slot = i; break;}
+    if ((armed_timers[i] == NULL) && (slot < 0)) {slot = i;}
+  }
+  if (slot < 0)
+  {
+    __set_PRIMASK(primask);
+    return 1;
+  }
+
+  timer->owner = owner;
+  timer->sig = sig;
+  timer->remaining = (milisec * HSM_TICK_HZ + 999) / 1000;
+  if (timer->remaining == 0) {timer->remaining = 1;}
+  armed_timers[slot] = timer;
+
+  if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk))     /* First armed timer: start the tick */
+  {
+    SystemCoreClockUpdate();
+    SysTick->LOAD = SystemCoreClock / HSM_TICK_HZ - 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+  }
+
+  __set_PRIMASK(primask);
+  return 0;
+}
+
+void hsmTimerDisarm(HsmTimer *timer)
+/*
+ * @BRIEF:          Stops a timer. An event it already posted stays in the queue.
+ *
+ * @ARGUMENTS:      HsmTimer *timer:      Timer
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (int i = 0; i < HSM_MAX_TIMERS; i++)
+  {
+    if (armed_timers[i] == timer) {armed_timers[i] = NULL;}
+  }
+  timer->remaining = 0;
+
+  __set_PRIMASK(primask);
+}
+
+void SysTick_Handler(void)
+/*
+ * @BRIEF:          Counts down the armed timers and posts the events of the expired ones.
+ *                  Stops SysTick when no timer is left, so no tick interrupts the sleep.
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  int armed = 0;
+
+  for (int i = 0; i < HSM_MAX_TIMERS; i++)
+  {
+    HsmTimer *timer = armed_timers[i];
+    if (timer == NULL) {continue;}
+
+    if (--timer->remaining == 0)
+    {
+      armed_timers[i] = NULL;
+      hsmPost(timer->owner, timer->sig);
+    }
+    else
+    {
+      armed++;
+    }
+  }
+
+  if (!armed) {SysTick->CTRL = 0;}
+}
@@ -7,58 +7,157 @@
  *                          occurs while the LED is on. (Interrupt happens before the LED turns off
  *                          by the delay)
  *
+ *                      The behaviour is modelled with two state machines (see hsm.h):
+ *                        - led:  Off -> On{Timed -> Latched} -> Off
+ *                        - mic:  Idle -> Settling -> Idle, filters the bounces of the
+ *                                microphone by masking its interrupt for DEBOUNCE_MS
+ *                      The interrupt handler only posts an event, and the CPU sleeps while
+ *                      there is nothing to do.
+ *
  * @HARDWARE:           - PE0: Electret microphone
  *                      - PE1: White LED
  *
  * @AUTHOR:             Hiram Montejano Gómez
- * 
+ *
  * @STARTING DATE:      10/08/2021
  *
- * @ENDING DATE:        11/08/2021
+ * @ENDING DATE:        18/10/2026
  */
 
+#include <stddef.h>
 #include "TM4C123GH6PM.h"
+#include "hsm.h"
+#include "gpio.h"
 
-extern void delayms(int milisec);
+#define LED_ON_MS       1000    /* Time the LED stays on after a single sound */
+#define DEBOUNCE_MS     75      /* Time the microphone interrupt stays masked */
+
+enum
+{
+  SOUND_SIG = HSM_USER_SIG,     /* mic -> led: a sound was detected             */
+  EDGE_SIG,                     /* GPIOE_Handler -> mic: rising edge on PE0     */
+  TIMEOUT_SIG                   /* Timer expired                                */
+};
 
 void PortE_Init(void);
 void GPIOE_Handler(void);
 
-int event, delay_flag;
+static int ledOff(Hsm *me, uint8_t sig);
+static int ledOn(Hsm *me, uint8_t sig);
+static int ledTimed(Hsm *me, uint8_t sig);
+static int ledLatched(Hsm *me, uint8_t sig);
+static int micIdle(Hsm *me, uint8_t sig);
+static int micSettling(Hsm *me, uint8_t sig);
+
+static const HsmState led_off = {NULL, ledOff};
+static const HsmState led_on = {NULL, ledOn};
+static const HsmState led_timed = {&led_on, ledTimed};
+static const HsmState led_latched = {&led_on, ledLatched};
+static const HsmState mic_idle = {NULL, micIdle};
+static const HsmState mic_settling = {NULL, micSettling};
+
+static Hsm led, mic;
+static HsmTimer led_timer, mic_timer;
 
 int main(void)
 {
+  static Hsm *const machines[] = {&mic, &led};
+
+  hsmInit(&led, &led_off);
+  hsmInit(&mic, &mic_idle);
   PortE_Init();
 
-  while(1)
+  hsmRun(machines, 2);
+
+  return 1;
+}
+
+static int ledOff(Hsm *me, uint8_t sig)
+{
+  switch(sig)
   {
-    switch(event)
-    {
-      case 1:
-        GPIOE->DATA |= (1<<1);      // Turn on led
-
-        delay_flag = 1;     // Delay starts
-        for (unsigned int i = 4000000; (i > 0) && (event == 1); i--) {} 
-        delay_flag = 0;     // Delay finishes
-        
-        if(event == 1)      // If delay has finished normaly, clear the event
-        {
-          event = 0;
-        } 
-        break;
-      case 2:
-        // Do nothing and wait for interrupt to trigger event 3
-        break;
-      case 3:
-        event = 0;     // Clear the event (process completed)
-        break;
-      default:
-        GPIOE->DATA &= ~(1<<1);     // Turn off led
-        break;
-    }
+    case SOUND_SIG:
+      return HSM_TRAN(me, &led_timed);
+    default:
+      return HSM_UNHANDLED;
   }
+}
 
-  return 1;   
+static int ledOn(Hsm *me, uint8_t sig)
+{
+  (void)me;
+
+  switch(sig)
+  {
+    case HSM_ENTRY_SIG:
+      GPIO_SET(GPIOE, GPIO_PIN(1));       // Turn on led
+      return HSM_HANDLED;
+    case HSM_EXIT_SIG:
+      GPIO_CLEAR(GPIOE, GPIO_PIN(1));     // Turn off led
+      return HSM_HANDLED;
+    default:
+      return HSM_UNHANDLED;
+  }
+}
+
+static int ledTimed(Hsm *me, uint8_t sig)
+{
+  switch(sig)
+  {
+    case HSM_ENTRY_SIG:
+      hsmTimerArm(&led_timer, me, TIMEOUT_SIG, LED_ON_MS);
+      return HSM_HANDLED;
+    case HSM_EXIT_SIG:
+      hsmTimerDisarm(&led_timer);
+      return HSM_HANDLED;
+    case TIMEOUT_SIG:
+      return HSM_TRAN(me, &led_off);
+    case SOUND_SIG:               // Sound while the led is on: keep it on
+      return HSM_TRAN(me, &led_latched);
+    default:
+      return HSM_UNHANDLED;
+  }
+}
+
+static int ledLatched(Hsm *me, uint8_t sig)
+{
+  switch(sig)
+  {
+    case SOUND_SIG:
+      return HSM_TRAN(me, &led_off);
+    default:
+      return HSM_UNHANDLED;
+  }
+}
+
+static int micIdle(Hsm *me, uint8_t sig)
+{
+  switch(sig)
+  {
+    case EDGE_SIG:
+      hsmPost(&led, SOUND_SIG);
+      return HSM_TRAN(me, &mic_settling);
+    default:
+      return HSM_UNHANDLED;
+  }
+}
+
+static int micSettling(Hsm *me, uint8_t sig)
+{
+  switch(sig)
+  {
+    case HSM_ENTRY_SIG:
+      hsmTimerArm(&mic_timer, me, TIMEOUT_SIG, DEBOUNCE_MS);
+      return HSM_HANDLED;
+    case HSM_EXIT_SIG:
+      GPIOE->ICR = 0x01;          // Forget the bounces
+      GPIOE->IM |= 0x01;          // Unmask interrupt in pin 0
+      return HSM_HANDLED;
+    case TIMEOUT_SIG:
+      return HSM_TRAN(me, &mic_idle);
+    default:
+      return HSM_UNHANDLED;
+  }
 }
 
 void PortE_Init(void)
@@ -77,30 +176,27 @@ void PortE_Init(void)
   GPIOE->DEN |= 0x03;                   /* Enable digital I/O for pins 0:1                        */
 
   /* Configure Interrupt */
-  GPIOE->IS &= ~0x01;                   /* Define interrupt in pin 0 as edge-sensitive            */ 
+  GPIOE->IS &= ~0x01;                   /* Define interrupt in pin 0 as edge-sensitive            */
   GPIOE->IBE &= ~0x01;                  /* Interrupt event trigger controlled by IEV register     */
   GPIOE->IEV |= 0x01;                   /* Interrupt in pin 0 triggered by rising edge            */
-  GPIOE->ICR |= 0x01;                   /* Clear prior interrupt flags                            */
+  GPIOE->ICR = 0x01;                    /* Clear prior interrupt flags                            */
   GPIOE->IM |= 0x01;                    /* Unmask interrupt in pin 0 (Enable interrupt)           */
 
-  NVIC->IP[1] |= (3<<5);                /* Set interrupt priority to 3                            */
-  NVIC->ISER[0] |= (1<<4);              /* Enable port E interrupt IRQ04                          */
+  NVIC_SetPriority(GPIOE_IRQn, 3);      /* Set interrupt priority to 3                            */
+  NVIC_EnableIRQ(GPIOE_IRQn);           /* Enable port E interrupt IRQ04                          */
 }
 
 void GPIOE_Handler(void)
 /*
- * @BRIEF:          Handles interrupts in port E
+ * @BRIEF:          Handles interrupts in port E. Masks the pin until the mic state machine
+ *                  has let the bounces settle.
  *
  * @ARGUMENTS:      None
  *
  * @RETURNS:        None
  */
 {
-  if(!delay_flag && !event) {event = 1;}      // If no event is running, trigger event 1
-  else if(delay_flag) {event = 2;}      // If event 1 is running, trigger event 2
-
-  if ((event == 2) && !delay_flag) {event = 3;}     // If event 2 is running, trigger event 3
-
-  GPIOE->ICR |= 0x01;           // Clear the interrupt event                                       
-  delayms(75);        // Prevent double trigger
-}
\ No newline at end of file
+  GPIOE->IM &= ~0x01;           // Mask interrupt in pin 0
+  GPIOE->ICR = 0x01;            // Clear the interrupt event (write 1 to clear)
+  hsmPost(&mic, EDGE_SIG);
+}
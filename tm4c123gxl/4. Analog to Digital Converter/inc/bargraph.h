@@ -0,0 +1,48 @@
+/*
+ * @FILENAME:           bargraph.h
+ *
+ * @DESCRIPTION:        Maps a value (an ADC sample, a distance, a temperature) to a band among a
+ *                      table of thresholds and shows the band on a group of pins of a GPIO port,
+ *                      usually a bar of LEDs.
+ *
+ *                      - The band is found with a binary search of the thresholds, so a table of
+ *                        any length costs a few comparisons.
+ *                      - The hysteresis keeps the current band until the value is that far past
+ *                        one of its thresholds, so a noisy value on a threshold does not toggle
+ *                        the LEDs.
+ *                      - The pins are written only when the band changes, in a single store to the
+ *                        masked GPIODATA address of the pins: the other pins of the port are not
+ *                        touched and there is no intermediate state between two writes.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _BARGRAPH_H_
+#define _BARGRAPH_H_
+
+#include <stdint.h>
+#include <TM4C123GH6PM.h>
+
+#define BARGRAPH_MAX_THRESHOLDS   31
+#define BARGRAPH_NONE             0xFF          /* No band written yet */
+
+typedef struct
+{
+  const uint32_t *thresholds;   /* Band i is from thresholds[i - 1] to below thresholds[i]  */
+  const uint8_t *outputs;       /* Pin values of every band, count + 1 entries              */
+  volatile uint32_t *data;      /* Masked GPIODATA address of the pins                      */
+  uint32_t hysteresis;
+  uint8_t count;                /* Number of thresholds                                     */
+  uint8_t band;                 /* Band on the pins, or BARGRAPH_NONE                       */
+} Bargraph;
+
+int bargraphInit(Bargraph *bar, const uint32_t *thresholds, const uint8_t *outputs, uint8_t count,
+                 uint32_t hysteresis, GPIOA_Type *port, uint8_t pins);
+uint8_t bargraphBand(const Bargraph *bar, uint32_t value);
+int bargraphUpdate(Bargraph *bar, uint32_t value);
+
+#endif
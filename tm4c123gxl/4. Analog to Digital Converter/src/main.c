@@ -5,6 +5,10 @@
  *                      and turns on a length of them based on
  *                      the input from a potentiometer
  *
+ *                      The bands of the potentiometer are a table (bargraph.h): the LEDs are
+ *                      only written when the band changes, in a single write, and the
+ *                      BAND_HYSTERESIS keeps the noise on a threshold from flickering them.
+ *
  * @HARDWARE:           - PE0 ->  Potentiometer
  *                      - PE1 ->  Green LED
  *                      - PE2 ->  Blue LED
@@ -20,6 +24,14 @@
  */
 
 #include <TM4C123GH6PM.h>
+#include "bargraph.h"
+
+#define BAND_THRESHOLDS   5
+#define BAND_HYSTERESIS   32          /* About 26 mV */
+#define LED_PINS          0x3E        /* PE1:5 */
+
+static const uint32_t band_thresholds[BAND_THRESHOLDS] = {680, 1360, 2040, 2720, 3400};
+static const uint8_t band_leds[BAND_THRESHOLDS + 1] = {0x00, 0x02, 0x06, 0x0E, 0x1E, 0x3E};
 
 void PortE_Init(void);
 unsigned int Get_ADC_Sample(void);
@@ -27,41 +39,17 @@ unsigned int Get_ADC_Sample(void);
 int main(void)
 {
   unsigned int adc_value;
+  Bargraph leds;
 
   PortE_Init();
+  bargraphInit(&leds, band_thresholds, band_leds, BAND_THRESHOLDS, BAND_HYSTERESIS, GPIOE,
+               LED_PINS);
 
   while(1)
   {
     adc_value = Get_ADC_Sample();
 
-    if(adc_value < 680)
-    {
-      GPIOE->DATA &= ~0x3E;     // Turn off all LEDs
-    }
-    else if((680 <= adc_value) && (adc_value < 1360))
-    {
-      GPIOE->DATA |= 0x02;      // Turn on first LED
-      GPIOE->DATA &= 0x02;      // Turn off the other LEDs
-    }
-    else if((1360 <= adc_value) && (adc_value < 2040))
-    {
-      GPIOE->DATA |= 0x06;      // Turn on the first 2 LEDs
-      GPIOE->DATA &= 0x06;      // Turn off the other LEDs
-    }
-    else if((2040 <= adc_value) && (adc_value < 2720))
-    {
-      GPIOE->DATA |= 0x0E;      // Turn on the first 3 LEDs
-      GPIOE->DATA &= 0x0E;      // Turn off the other LEDs
-    }
-    else if((2720 <= adc_value) && (adc_value < 3400))
-    {
-      GPIOE->DATA |= 0x1E;      // Turnn on the first 4 LEDs
-      GPIOE->DATA &= 0x1E;      // Turn off the other LEDs
-    }
-    else if(3400 <= adc_value)
-    {
-      GPIOE->DATA |= 0x3E;      // Turn on all LEDs
-    }
+    bargraphUpdate(&leds, adc_value);
   }
 
   return 0;
@@ -0,0 +1,87 @@
+/*
+ * @FILENAME:           adc.h
+ *
+ * @DESCRIPTION:        ADC0 sampling with a callback from the sequencer interrupt:
+ *
+ *                      - adcInit():      one channel with sample sequencer 3, one interrupt
+ *                                        per conversion.
+ *                      - adcScanInit():  a sequence of up to 8 steps (any channels, and the
+ *                                        temperature sensor) with sample sequencer 0 and one
+ *                                        interrupt at the end of the sequence, so 8 samples
+ *                                        cost a single interrupt. Every step can be the
+ *                                        hardware average (SAC) of up to 64 conversions,
+ *                                        which lowers the noise without any CPU work: each
+ *                                        4x of averaging adds about one bit of resolution.
+ *                      - adcBandInit():  the band of a channel among a set of thresholds,
+ *                                        tracked by two digital comparators with sample
+ *                                        sequencer 2. The samples go to the comparators
+ *                                        instead of a FIFO, and the only interrupts are the
+ *                                        ones of a comparator, when the signal leaves the
+ *                                        current band: the CPU does nothing while the band
+ *                                        does not change.
+ *
+ *                      adcCompInit() configures a comparator directly, for other uses of its
+ *                      regions and hysteresis modes.
+ *
+ *                      The conversions are started either by timer 0A (EMUX timer trigger),
+ *                      at a fixed rate set by the hardware, or by software from the interrupt
+ *                      handler itself (PSSI), as fast as the CPU re-arms the sequencer. With the
+ *                      timer the sample instants do not depend on the interrupt latency or on
+ *                      what the CPU is doing, only the delivery of the result does. Only one
+ *                      of the two modes runs at a time.
+ *
+ *                      The analog pin of the channel (AFSEL, AMSEL, DEN) is configured by the
+ *                      application.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _ADC_H_
+#define _ADC_H_
+
+#include <stdint.h>
+
+#define ADC_SYSCLK_HZ       16000000UL        /* Reset clock (PIOSC), SystemInit is not called */
+#define ADC_MAX_RATE_HZ     1000000UL         /* ADC0->PC reset value: 1 Msps */
+#define ADC_CHANNELS        12                /* AIN0 to AIN11 */
+#define ADC_CHANNEL_TEMP    0xFF              /* Temperature sensor, in a scan sequence */
+#define ADC_SCAN_STEPS      8                 /* Steps of sample sequencer 0 */
+#define ADC_MAX_AVERAGING   6                 /* log2 of the largest hardware average (64x) */
+#define ADC_MAX_VALUE       4095
+#define ADC_COMPARATORS     8
+#define ADC_MAX_THRESHOLDS  15                /* Up to 16 bands */
+
+/* Interrupt modes of a digital comparator */
+typedef enum
+{
+  ADC_DC_ALWAYS,            /* Every sample in the region */
+  ADC_DC_ONCE,              /* The first sample in the region after one out of it */
+  ADC_DC_HYST_ALWAYS,       /* Every sample in the region, until one in the opposite region */
+  ADC_DC_HYST_ONCE          /* The first sample in the region after one in the opposite region */
+} AdcDcMode;
+
+/* Regions of a comparator: up to COMP0, above COMP0 up to COMP1, above COMP1 (DCCTLn.CIC) */
+typedef enum
+{
+  ADC_DC_LOW = 0,
+  ADC_DC_MID = 1,
+  ADC_DC_HIGH = 3           /* 2 is reserved */
+} AdcDcRegion;
+
+typedef void (*AdcCallback)(uint16_t sample);
+typedef void (*AdcScanCallback)(const uint16_t *samples, uint32_t count);
+typedef void (*AdcBandCallback)(uint8_t band);
+
+int adcInit(uint8_t channel, uint32_t rate_hz, AdcCallback callback);
+int adcScanInit(const uint8_t *channels, uint8_t count, uint8_t averaging, uint32_t rate_hz,
+                AdcScanCallback callback);
+int adcCompInit(uint8_t comp, uint16_t comp0, uint16_t comp1, AdcDcMode mode, AdcDcRegion region);
+int adcBandInit(uint8_t channel, const uint16_t *thresholds, uint8_t count, uint16_t hysteresis,
+                uint32_t rate_hz, AdcBandCallback callback);
+void adcStop(void);
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * @FILENAME:           filter.h
+ *
+ * @DESCRIPTION:        Block-oriented Q15 filters with the dual multiply-accumulate (SMLAD,
+ *                      SMLALD) instructions of the Cortex-M4. Every call filters a block of
+ *                      samples, e.g. a half-buffer filled by the ADC, and keeps the history
+ *                      needed to continue with the next block.
+ *
+ *                      - FIR:      y[n] = sum of c[k] * x[n - k], k = 0..taps-1. Two taps per
+ *                                  instruction into a 32-bit Q30 accumulator, so the sum of the
+ *                                  absolute values of the coefficients must be below 2 (any
+ *                                  filter with a gain of 1 or less in practice).
+ *                      - Biquad:   cascade of second order IIR sections (Direct Form I),
+ *                                  y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2],
+ *                                  with a 64-bit accumulator. Note the sign of a1 and a2: they
+ *                                  are the negated denominator coefficients of the usual form.
+ *
+ *                      The cost of a FIR grows with the number of taps and the one of a biquad
+ *                      with the number of stages; the Fixed Point app measures the cycles per
+ *                      sample of both, to size them against the sample rate.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _FILTER_H_
+#define _FILTER_H_
+
+#include <stdint.h>
+#include "fixed.h"
+
+/* Samples of state needed by a FIR, and by a biquad cascade */
+#define FIR_STATE_SIZE(taps, block)     ((taps) - 1 + (block))
+#define BIQUAD_STATE_SIZE(stages)       (4 * (stages))
+
+typedef struct
+{
+  const q15_t *coeffs;          /* taps coefficients in time-reversed order, word aligned */
+  q15_t *state;                 /* FIR_STATE_SIZE(taps, block) samples                    */
+  uint16_t taps;
+  uint16_t block;               /* Maximum number of samples per call                     */
+} FirQ15;
+
+typedef struct
+{
+  const q15_t *coeffs;          /* 6 per stage: {b0, 0, b1, b2, a1, a2}, word aligned      */
+  q15_t *state;                 /* BIQUAD_STATE_SIZE(stages) samples, word aligned         */
+  uint8_t stages;
+  uint8_t post_shift;           /* Coefficients are in Q(15 - post_shift), e.g. 1 for Q14  */
+} BiquadQ15;
+
+void firInit(FirQ15 *fir, const q15_t *coeffs, uint16_t taps, q15_t *state, uint16_t block);
+int firProcess(FirQ15 *fir, const q15_t *in, q15_t *out, uint32_t n);
+void biquadInit(BiquadQ15 *biquad, const q15_t *coeffs, uint8_t stages, uint8_t post_shift,
+                q15_t *state);
+void biquadProcess(BiquadQ15 *biquad, const q15_t *in, q15_t *out, uint32_t n);
+
+#endif
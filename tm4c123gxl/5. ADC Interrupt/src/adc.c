@@ -0,0 +1,406 @@
+/*
+ * @FILENAME:           adc.c
+ *
+ * @DESCRIPTION:        ADC0 sampling with sample sequencers 3 and 0 (see adc.h).
+ *
+ *                      In timer mode, timer 0A runs in 32-bit periodic mode with its ADC
+ *                      trigger output enabled (TAOTE), and the sequencer takes its trigger from
+ *                      it (EMUX 0x5): every time-out starts one conversion (SS3) or one whole
+ *                      sequence (SS0). The timer does not need its own interrupt.
+ *
+ *                      The SAC averaging applies to every sequencer of ADC0, so adcInit() and
+ *                      adcBandInit() turn it off again.
+ *
+ *                      The band tracker converts the channel twice per trigger, in two steps of
+ *                      SS2 routed to comparators 0 and 1 (SSOP2, SSDC2). Comparator 0
+ *                      interrupts below the lower threshold of the current band minus the
+ *                      hysteresis, and comparator 1 above the upper one plus the hysteresis,
+ *                      in the low (data <= COMP0) and high (data > COMP1) regions of the
+ *                      datasheet. The interrupt moves
+ *                      the band one step and the edges with it. A jump over several bands takes
+ *                      one interrupt per band, one sample apart.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+#include "adc.h"
+
+#define ADC_SS0             (1 << 0)
+#define ADC_SS3             (1 << 3)
+#define ADC_EMUX_SS0_MASK   0x000F
+#define ADC_EMUX_SS0_TIMER  0x0005
+#define ADC_EMUX_SS3_MASK   0xF000
+#define ADC_EMUX_SS3_TIMER  0x5000
+#define ADC_SSCTL_END       0x02            /* In the nibble of a step */
+#define ADC_SSCTL_IE        0x04
+#define ADC_SSCTL_TS        0x08
+#define ADC_SSCTL_END0_IE0  0x06            /* One sample, interrupt at the end */
+#define ADC_SSFSTAT_EMPTY   (1 << 8)
+#define ADC_SS2             (1 << 2)
+#define ADC_EMUX_SS2_MASK   0x0F00
+#define ADC_EMUX_SS2_TIMER  0x0500
+#define ADC_IM_DCONSS2      (1 << 18)       /* Comparator interrupts on the SS2 vector */
+#define ADC_DCCTL_CIE       (1 << 4)
+#define ADC_DC_LOWER        0               /* Comparators of the band tracker */
+#define ADC_DC_UPPER        1
+#define TIMER_CTL_TAEN      (1 << 0)
+#define TIMER_CTL_TAOTE     (1 << 5)
+#define TIMER_TAMR_PERIODIC 0x02
+
+static AdcCallback adc_callback;
+static AdcScanCallback adc_scan_callback;
+static uint8_t adc_software;                /* Re-arm the sequencer from the handler */
+static uint16_t adc_scan[ADC_SCAN_STEPS];
+static AdcBandCallback adc_band_callback;
+static uint16_t adc_thresholds[ADC_MAX_THRESHOLDS];
+static uint8_t adc_threshold_count;
+static uint16_t adc_hysteresis;
+static volatile uint8_t adc_band;
+
+static void adcClockEnable(void)
+/*
+ * @BRIEF:          Enables the clock of ADC0 and waits until it is ready
+ */
+{
+  SYSCTL->RCGCADC |= 0x01;                  // Enable and provide clock for ADC0
+  while ((SYSCTL->PRADC & 0x01) == 0);      // Wait until ADC0 is ready
+}
+
+static void adcTimerInit(uint32_t rate_hz)
+/*
+ * @BRIEF:          Configures timer 0A to trigger the ADC rate_hz times per second. The timer
+ *                  is started with adcTimerStart(), once the sequencer is enabled.
+ */
+{
+  SYSCTL->RCGCTIMER |= 0x01;                // Enable and provide clock to timer 0
+  while ((SYSCTL->PRTIMER & 0x01) == 0);    // Wait until timer 0 is ready
+
+  TIMER0->CTL = 0;                          // Disable timer 0 during configuration
+  TIMER0->CFG = 0;                          // 32-bit timer
+  TIMER0->TAMR = TIMER_TAMR_PERIODIC;
+  TIMER0->TAILR = ADC_SYSCLK_HZ / rate_hz - 1;
+}
+
+static void adcTimerStart(void)
+/*
+ * @BRIEF:          Starts timer 0A with its ADC trigger output enabled
+ */
+{
+  TIMER0->CTL = TIMER_CTL_TAOTE | TIMER_CTL_TAEN;
+}
+
+int adcInit(uint8_t channel, uint32_t rate_hz, AdcCallback callback)
+/*
+ * @BRIEF:          Configures SS3 for a channel and starts sampling it
+ *
+ * @ARGUMENTS:      uint8_t channel:        Analog input, 0 (AIN0) to ADC_CHANNELS - 1
+ *                  uint32_t rate_hz:       Samples per second, up to ADC_MAX_RATE_HZ, triggered
+ *                                          by timer 0A, or 0 to trigger every conversion by
+ *                                          software from the interrupt handler
+ *                  AdcCallback callback:   Function called with every result, from the ADC0
+ *                                          SS3 interrupt handler
+ *
+ * @RETURNS:        0 if sampling, 1 if an argument is wrong
+ */
+{
+  if (channel >= ADC_CHANNELS || rate_hz > ADC_MAX_RATE_HZ || callback == 0) {return 1;}
+
+  adcStop();
+  adcClockEnable();
+
+  adc_callback = callback;
+  adc_software = (rate_hz == 0);
+
+  ADC0->SAC = 0;                            // No hardware averaging
+  ADC0->SSMUX3 = channel;
+  ADC0->SSCTL3 = ADC_SSCTL_END0_IE0;
+  ADC0->ISC = ADC_SS3;                      // Clear any old completion flag
+  ADC0->IM |= ADC_SS3;                      // Unmask the SS3 interrupt
+  NVIC_EnableIRQ(ADC0SS3_IRQn);
+
+  if (adc_software)
+  {
+    ADC0->EMUX &= ~ADC_EMUX_SS3_MASK;       // Triggered by PSSI
+    ADC0->ACTSS |= ADC_SS3;
+    ADC0->PSSI = ADC_SS3;                   // First conversion, the next ones from the handler
+    return 0;
+  }
+
+  adcTimerInit(rate_hz);
+  ADC0->EMUX = (ADC0->EMUX & ~ADC_EMUX_SS3_MASK) | ADC_EMUX_SS3_TIMER;
+  ADC0->ACTSS |= ADC_SS3;
+  adcTimerStart();
+
+  return 0;
+}
+
+int adcScanInit(const uint8_t *channels, uint8_t count, uint8_t averaging, uint32_t rate_hz,
+                AdcScanCallback callback)
+/*
+ * @BRIEF:          Configures SS0 for a sequence of channels and starts sampling it, triggered
+ *                  by timer 0A
+ *
+ * @ARGUMENTS:      const uint8_t *channels:    Analog inputs in conversion order, 0 (AIN0) to
+ *                                              ADC_CHANNELS - 1 or ADC_CHANNEL_TEMP
+ *                  uint8_t count:              Number of steps, 1 to ADC_SCAN_STEPS
+ *                  uint8_t averaging:          log2 of the conversions averaged by the hardware
+ *                                              for every step, 0 to ADC_MAX_AVERAGING
+ *                  uint32_t rate_hz:           Sequences per second. Every sequence takes
+ *                                              count << averaging conversions, which must fit
+ *                                              in ADC_MAX_RATE_HZ
+ *                  AdcScanCallback callback:   Function called with the count results of every
+ *                                              sequence, from the ADC0 SS0 interrupt handler
+ *
+ * @RETURNS:        0 if sampling, 1 if an argument is wrong
+ */
+{
+  uint32_t mux = 0;
+  uint32_t ctl = 0;
+
+  if (channels == 0 || count == 0 || count > ADC_SCAN_STEPS || averaging > ADC_MAX_AVERAGING ||
+      rate_hz == 0 || callback == 0)
+  {
+    return 1;
+  }
+  if (rate_hz > (ADC_MAX_RATE_HZ >> averaging) / count) {return 1;}
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    if (channels[i] == ADC_CHANNEL_TEMP) {ctl |= ADC_SSCTL_TS << (4 * i);}
+    else if (channels[i] < ADC_CHANNELS) {mux |= (uint32_t)channels[i] << (4 * i);}
+    else {return 1;}
+  }
+  ctl |= (ADC_SSCTL_END | ADC_SSCTL_IE) << (4 * (count - 1));     // Interrupt at the last step
+
+  adcStop();
+  adcClockEnable();
+
+  adc_scan_callback = callback;
+
+  ADC0->SAC = averaging;
+  ADC0->SSMUX0 = mux;
+  ADC0->SSCTL0 = ctl;
+  ADC0->ISC = ADC_SS0;                      // Clear any old completion flag
+  ADC0->IM |= ADC_SS0;                      // Unmask the SS0 interrupt
+  NVIC_EnableIRQ(ADC0SS0_IRQn);
+
+  adcTimerInit(rate_hz);
+  ADC0->EMUX = (ADC0->EMUX & ~ADC_EMUX_SS0_MASK) | ADC_EMUX_SS0_TIMER;
+  ADC0->ACTSS |= ADC_SS0;
+  adcTimerStart();
+
+  return 0;
+}
+
+int adcCompInit(uint8_t comp, uint16_t comp0, uint16_t comp1, AdcDcMode mode, AdcDcRegion region)
+/*
+ * @BRIEF:          Configures the thresholds and the interrupt condition of a digital
+ *                  comparator and resets its hysteresis state. The comparator gets samples from
+ *                  the steps routed to it (SSOPn, SSDCn), and its interrupts reach the vector of
+ *                  a sequencer whose DCONSSn bit is set in ADC0->IM
+ *
+ * @ARGUMENTS:      uint8_t comp:           Comparator, 0 to ADC_COMPARATORS - 1
+ *                  uint16_t comp0:         Lower threshold, up to comp1
+ *                  uint16_t comp1:         Upper threshold, up to ADC_MAX_VALUE
+ *                  AdcDcMode mode:         When the interrupt happens
+ *                  AdcDcRegion region:     Region that interrupts. The hysteresis modes only
+ *                                          work with ADC_DC_LOW and ADC_DC_HIGH
+ *
+ * @RETURNS:        0 if configured, 1 if an argument is wrong
+ */
+{
+  if (comp >= ADC_COMPARATORS || comp0 > comp1 || comp1 > ADC_MAX_VALUE ||
+      mode > ADC_DC_HYST_ONCE ||
+      (region != ADC_DC_LOW && region != ADC_DC_MID && region != ADC_DC_HIGH))
+  {
+    return 1;
+  }
+  if ((mode == ADC_DC_HYST_ALWAYS || mode == ADC_DC_HYST_ONCE) && region == ADC_DC_MID) {return 1;}
+
+  (&ADC0->DCCMP0)[comp] = ((uint32_t)comp1 << 16) | comp0;
+  (&ADC0->DCCTL0)[comp] = ADC_DCCTL_CIE | ((uint32_t)region << 2) | (uint32_t)mode;
+  ADC0->DCRIC = 1UL << comp;                // Reset the interrupt condition
+  ADC0->DCISC = 1UL << comp;
+
+  return 0;
+}
+
+static void adcBandEdges(void)
+/*
+ * @BRIEF:          Moves the interrupt thresholds of the band tracker around the current band.
+ *                  The band goes down when a sample is below its lower threshold minus the
+ *                  hysteresis (data <= COMP0 = t - h - 1) and up when a sample is above its
+ *                  upper threshold plus the hysteresis (data > COMP1 = t + h). An edge that no
+ *                  sample can cross (the lowest and highest bands, or a hysteresis past 0 or
+ *                  ADC_MAX_VALUE) turns its comparator off.
+ */
+{
+  uint8_t band = adc_band;
+  uint32_t h = adc_hysteresis;
+
+  if (band == 0 || adc_thresholds[band - 1] <= h) {ADC0->DCCTL0 = 0;}
+  else
+  {
+    uint32_t edge = adc_thresholds[band - 1] - h - 1;
+
+    adcCompInit(ADC_DC_LOWER, edge, edge, ADC_DC_ALWAYS, ADC_DC_LOW);
+  }
+
+  if (band == adc_threshold_count || adc_thresholds[band] + h >= ADC_MAX_VALUE) {ADC0->DCCTL1 = 0;}
+  else
+  {
+    uint32_t edge = adc_thresholds[band] + h;
+
+    adcCompInit(ADC_DC_UPPER, edge, edge, ADC_DC_ALWAYS, ADC_DC_HIGH);
+  }
+}
+
+int adcBandInit(uint8_t channel, const uint16_t *thresholds, uint8_t count, uint16_t hysteresis,
+                uint32_t rate_hz, AdcBandCallback callback)
+/*
+ * @BRIEF:          Starts tracking the band of a channel: band 0 below thresholds[0], band i
+ *                  from thresholds[i - 1] to below thresholds[i], and band count from
+ *                  thresholds[count - 1] up. The tracker starts in band 0 and climbs to the
+ *                  band of the signal in the first samples, calling the callback every step.
+ *
+ * @ARGUMENTS:      uint8_t channel:            Analog input, 0 (AIN0) to ADC_CHANNELS - 1
+ *                  const uint16_t *thresholds: Band edges in increasing order, up to
+ *                                              ADC_MAX_VALUE (copied)
+ *                  uint8_t count:              Number of thresholds, 1 to ADC_MAX_THRESHOLDS
+ *                  uint16_t hysteresis:        How far past a threshold the signal must go to
+ *                                              change band, in ADC counts
+ *                  uint32_t rate_hz:           Samples per second, triggered by timer 0A
+ *                  AdcBandCallback callback:   Function called with every new band, from the
+ *                                              ADC0 SS2 interrupt handler
+ *
+ * @RETURNS:        0 if tracking, 1 if an argument is wrong
+ */
+{
+  if (channel >= ADC_CHANNELS || thresholds == 0 || count == 0 || count > ADC_MAX_THRESHOLDS ||
+      rate_hz == 0 || rate_hz > ADC_MAX_RATE_HZ / 2 || callback == 0)
+  {
+    return 1;
+  }
+  for (uint32_t i = 0; i < count; i++)
+  {
+    if (thresholds[i] > ADC_MAX_VALUE || (i > 0 && thresholds[i] <= thresholds[i - 1])) {return 1;}
+  }
+
+  adcStop();
+  adcClockEnable();
+
+  for (uint32_t i = 0; i < count; i++) {adc_thresholds[i] = thresholds[i];}
+  adc_threshold_count = count;
+  adc_hysteresis = hysteresis;
+  adc_band_callback = callback;
+  adc_band = 0;
+  adcBandEdges();
+
+  ADC0->SAC = 0;                            // No hardware averaging
+  ADC0->SSMUX2 = ((uint32_t)channel << 4) | channel;
+  ADC0->SSCTL2 = ADC_SSCTL_END << 4;        // Two steps, no sequence interrupt
+  ADC0->SSOP2 = 0x11;                       // Both steps to a comparator, none to the FIFO
+  ADC0->SSDC2 = (ADC_DC_UPPER << 4) | ADC_DC_LOWER;
+  ADC0->ISC = ADC_IM_DCONSS2;
+  ADC0->IM |= ADC_IM_DCONSS2;
+  NVIC_EnableIRQ(ADC0SS2_IRQn);
+
+  adcTimerInit(rate_hz);
+  ADC0->EMUX = (ADC0->EMUX & ~ADC_EMUX_SS2_MASK) | ADC_EMUX_SS2_TIMER;
+  ADC0->ACTSS |= ADC_SS2;
+  adcTimerStart();
+
+  return 0;
+}
+
+void adcStop(void)
+/*
+ * @BRIEF:          Stops sampling. A conversion in progress is discarded.
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  if (SYSCTL->RCGCTIMER & 0x01) {TIMER0->CTL = 0;}
+  if ((SYSCTL->RCGCADC & 0x01) == 0) {return;}
+
+  adc_software = 0;                         // The handler must not start another conversion
+  ADC0->ACTSS &= ~(ADC_SS0 | ADC_SS2 | ADC_SS3);
+  ADC0->IM &= ~(ADC_SS0 | ADC_SS3 | ADC_IM_DCONSS2);
+  ADC0->ISC = ADC_SS0 | ADC_SS3 | ADC_IM_DCONSS2;
+  ADC0->DCCTL0 = 0;
+  ADC0->DCCTL1 = 0;
+  ADC0->DCISC = 0xFF;
+  NVIC_ClearPendingIRQ(ADC0SS0_IRQn);
+  NVIC_ClearPendingIRQ(ADC0SS2_IRQn);
+  NVIC_ClearPendingIRQ(ADC0SS3_IRQn);
+}
+
+void ADC0SS3_Handler(void)
+/*
+ * @BRIEF:          Interrupt handler for ADC0 SS3: passes the result to the callback and, in
+ *                  software mode, starts the next conversion
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint16_t sample = ADC0->SSFIFO3;          // Read conversion result from SS3 FIFO
+
+  ADC0->ISC = ADC_SS3;                      // Clear "conversion completed" interrupt flag
+  if (adc_software) {ADC0->PSSI = ADC_SS3;}
+
+  adc_callback(sample);
+}
+
+void ADC0SS0_Handler(void)
+/*
+ * @BRIEF:          Interrupt handler for ADC0 SS0: empties the FIFO and passes the sequence to
+ *                  the callback
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t count = 0;
+
+  while ((ADC0->SSFSTAT0 & ADC_SSFSTAT_EMPTY) == 0 && count < ADC_SCAN_STEPS)
+  {
+    adc_scan[count++] = ADC0->SSFIFO0;
+  }
+  ADC0->ISC = ADC_SS0;                      // Clear "sequence completed" interrupt flag
+
+  adc_scan_callback(adc_scan, count);
+}
+
+void ADC0SS2_Handler(void)
+/*
+ * @BRIEF:          Interrupt handler for the comparators of the band tracker: moves the band
+ *                  one step towards the signal and passes it to the callback
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t status = ADC0->DCISC;
+
+  ADC0->DCISC = status;                     // Clear the comparator interrupt flags
+  ADC0->ISC = ADC_IM_DCONSS2;
+
+  if ((status & (1 << ADC_DC_LOWER)) && adc_band > 0) {adc_band--;}
+  else if ((status & (1 << ADC_DC_UPPER)) && adc_band < adc_threshold_count) {adc_band++;}
+  else {return;}
+
+  adcBandEdges();
+  adc_band_callback(adc_band);
+}
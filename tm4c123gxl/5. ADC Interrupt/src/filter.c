@@ -0,0 +1,160 @@
+/*
+ * @FILENAME:           filter.c
+ *
+ * @DESCRIPTION:        Block-oriented Q15 FIR and biquad filters (see filter.h).
+ *
+ *                      The FIR keeps the last taps - 1 input samples at the start of its state
+ *                      buffer and appends each new block after them, so every output is a dot
+ *                      product of the time-reversed coefficients with a contiguous window of
+ *                      the state. The window starts at any sample, so its pairs are read with
+ *                      unaligned loads (LDR supports them, LDRD and LDM do not).
+ *
+ *                      The biquad keeps x[n-1], x[n-2] and y[n-1], y[n-2] of every stage packed
+ *                      in two words, and repacks them with PKHBT after every sample.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+#include "fixed.h"
+#include "fixvec.h"
+#include "filter.h"
+
+void firInit(FirQ15 *fir, const q15_t *coeffs, uint16_t taps, q15_t *state, uint16_t block)
+/*
+ * @BRIEF:          Initializes a FIR filter with an empty (all zero) history
+ *
+ * @ARGUMENTS:      FirQ15 *fir:            Filter
+ *                  const q15_t *coeffs:    Coefficients in time-reversed order (c[taps - 1]
+ *                                          first), word aligned
+ *                  uint16_t taps:          Number of coefficients
+ *                  q15_t *state:           FIR_STATE_SIZE(taps, block) samples
+ *                  uint16_t block:         Maximum number of samples per firProcess() call
+ *
+ * @RETURNS:        None
+ */
+{
+  fir->coeffs = coeffs;
+  fir->state = state;
+  fir->taps = taps;
+  fir->block = block;
+
+  for (uint32_t i = 0; i < FIR_STATE_SIZE(taps, block); i++) {state[i] = 0;}
+}
+
+int firProcess(FirQ15 *fir, const q15_t *in, q15_t *out, uint32_t n)
+/*
+ * @BRIEF:          Filters a block of samples
+ *
+ * @ARGUMENTS:      FirQ15 *fir:            Filter
+ *                  const q15_t *in:        Input samples
+ *                  q15_t *out:             Output samples (may be in)
+ *                  uint32_t n:             Number of samples
+ *
+ * @RETURNS:        0 if filtered, 1 if n is larger than the block size of the filter
+ */
+{
+  const q15_t *coeffs = fir->coeffs;
+  q15_t *history = fir->state;
+  uint32_t taps = fir->taps;
+
+  if (n > fir->block) {return 1;}
+
+  for (uint32_t i = 0; i < n; i++) {history[taps - 1 + i] = in[i];}
+
+  for (uint32_t k = 0; k < n; k++)
+  {
+    const q15_t *x = &history[k];       /* x[taps - 1] is the newest sample */
+    int32_t acc = 0;                    /* Q30 */
+    uint32_t j;
+
+    for (j = 0; j + 1 < taps; j += 2)
+    {
+      acc = (int32_t)__SMLAD(__UNALIGNED_UINT32_READ(&x[j]), *(const q15x2_t *)&coeffs[j],
+                             (uint32_t)acc);
+    }
+    if (j < taps) {acc += (int32_t)coeffs[j] * x[j];}      /* Odd number of taps */
+
+    out[k] = (q15_t)__SSAT(acc >> 15, 16);
+  }
+
+  for (uint32_t i = 0; i < taps - 1; i++) {history[i] = history[i + n];}
+
+  return 0;
+}
+
+void biquadInit(BiquadQ15 *biquad, const q15_t *coeffs, uint8_t stages, uint8_t post_shift,
+                q15_t *state)
+/*
+ * @BRIEF:          Initializes a biquad cascade with an empty (all zero) history
+ *
+ * @ARGUMENTS:      BiquadQ15 *biquad:      Filter
+ *                  const q15_t *coeffs:    {b0, 0, b1, b2, a1, a2} for every stage, word
+ *                                          aligned, in Q(15 - post_shift)
+ *                  uint8_t stages:         Number of second order sections
+ *                  uint8_t post_shift:     Scale of the coefficients (0 to 15)
+ *                  q15_t *state:           BIQUAD_STATE_SIZE(stages) samples, word aligned
+ *
+ * @RETURNS:        None
+ */
+{
+  biquad->coeffs = coeffs;
+  biquad->state = state;
+  biquad->stages = stages;
+  biquad->post_shift = post_shift;
+
+  for (uint32_t i = 0; i < BIQUAD_STATE_SIZE(stages); i++) {state[i] = 0;}
+}
+
+void biquadProcess(BiquadQ15 *biquad, const q15_t *in, q15_t *out, uint32_t n)
+/*
+ * @BRIEF:          Filters a block of samples through every stage
+ *
+ * @ARGUMENTS:      BiquadQ15 *biquad:      Filter
+ *                  const q15_t *in:        Input samples
+ *                  q15_t *out:             Output samples (may be in)
+ *                  uint32_t n:             Number of samples
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t shift = 15 - biquad->post_shift;
+  const q15_t *src = in;
+
+  for (uint32_t s = 0; s < biquad->stages; s++)
+  {
+    const q15_t *c = &biquad->coeffs[6 * s];
+    q15x2_t *history = (q15x2_t *)&biquad->state[4 * s];
+    uint32_t b12 = *(const q15x2_t *)&c[2];
+    uint32_t a12 = *(const q15x2_t *)&c[4];
+    uint32_t x12 = history[0];          /* x[n-1] in the bottom half, x[n-2] in the top one */
+    uint32_t y12 = history[1];          /* y[n-1] in the bottom half, y[n-2] in the top one */
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+      int32_t x0 = src[i];
+      int64_t acc = (int32_t)c[0] * x0;
+
+      acc = (int64_t)__SMLALD(x12, b12, (uint64_t)acc);
+      acc = (int64_t)__SMLALD(y12, a12, (uint64_t)acc);
+
+      /* Clamping to 32 bits first does not change the result, which saturates anyway */
+      if (acc > INT32_MAX) {acc = INT32_MAX;}
+      else if (acc < INT32_MIN) {acc = INT32_MIN;}
+      int32_t y0 = __SSAT((int32_t)acc >> shift, 16);
+
+      x12 = __PKHBT(x0, x12, 16);
+      y12 = __PKHBT(y0, y12, 16);
+      out[i] = (q15_t)y0;
+    }
+
+    history[0] = x12;
+    history[1] = y12;
+    src = out;                          /* The next stage filters the output of this one */
+  }
+}
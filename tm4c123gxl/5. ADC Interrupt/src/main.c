@@ -10,6 +10,31 @@
  *                      processing time and resources), we use the ADC interrupt
  *                      handler to read the conversion value.
  *
+ *                      The conversions are started by timer 0A (adc.h), so the sample rate does
+ *                      not depend on the CPU: sequences of ADC_SCAN_STEPS samples of the
+ *                      potentiometer, each one the hardware average of 2^ADC_AVERAGING
+ *                      conversions, at ADC_RATE_HZ samples per second in total. The interrupt
+ *                      comes once per sequence, 8 times less often than once per sample.
+ *
+ *                      At startup the app measures the rate and the jitter of the interrupts
+ *                      with the DWT cycle counter ("print bench_adc" in gdb): with every
+ *                      conversion started by software from the handler, with the timer trigger
+ *                      and one interrupt per sample, and with the timer trigger and one
+ *                      interrupt per sequence. The jitter of the timer trigger is only the one of
+ *                      the interrupt latency, the samples themselves are taken at exact
+ *                      intervals.
+ *
+ *                      Every sequence is a block for the FIR low-pass filter of filter.h, which
+ *                      keeps its history between blocks: adc_value holds the newest filtered
+ *                      sample instead of the raw one.
+ *
+ *                      After the benchmark the LEDs follow the band of the potentiometer
+ *                      among BAND_THRESHOLDS, tracked by the digital comparators of the ADC
+ *                      (adcBandInit()): the conversions go on at BAND_RATE_HZ, but the CPU
+ *                      sleeps and only wakes when the signal crosses into another band, to
+ *                      write the LEDs of that band. The BAND_HYSTERESIS keeps the noise of a
+ *                      potentiometer on a threshold from flickering the LEDs.
+ *
  * @HARDWARE:           - PE0 ->  Potentiometer
  *                      - PE1 ->  Green LED
  *                      - PE2 ->  Blue LED
@@ -25,47 +50,74 @@
  */
 
 #include <TM4C123GH6PM.h>
+#include "adc.h"
+#include "gpio.h"
+#include "filter.h"
+
+#define ADC_CHANNEL       3           /* AIN3 (PE0) */
+#define ADC_RATE_HZ       10000
+#define ADC_AVERAGING     4           /* 16x */
+#define BENCH_SAMPLES     1000        /* Interrupts timed in each mode */
+#define BAND_COUNT        6
+#define BAND_RATE_HZ      1000
+#define BAND_HYSTERESIS   32          /* About 26 mV */
+#define LED_PINS          0x3E        /* PE1:5 */
+#define FIR_TAPS          8           /* Moving average of the last 8 samples */
+
+enum {BENCH_SOFTWARE, BENCH_TIMER, BENCH_SCAN, BENCH_MODES};
+
+typedef struct
+{
+  uint32_t rate_hz;                   /* ADC_SYSCLK_HZ / mean interval between interrupts */
+  uint32_t min_cycles;                /* Shortest interval */
+  uint32_t max_cycles;                /* Longest interval */
+  uint32_t jitter_cycles;             /* max_cycles - min_cycles */
+} BenchAdc;
 
 void PortE_Init(void);
-void ADC0SS3_Handler(void);
+void Bench_ADC(void);
+void ADC_Sample(uint16_t sample);
+void ADC_Scan(const uint16_t *samples, uint32_t count);
+void ADC_Band(uint8_t band);
 
 volatile unsigned int adc_value;
+volatile BenchAdc bench_adc[BENCH_MODES];
+
+static const uint8_t scan_channels[ADC_SCAN_STEPS] =
+{
+  ADC_CHANNEL, ADC_CHANNEL, ADC_CHANNEL, ADC_CHANNEL,
+  ADC_CHANNEL, ADC_CHANNEL, ADC_CHANNEL, ADC_CHANNEL
+};
+
+static const uint16_t band_thresholds[BAND_COUNT - 1] = {680, 1360, 2040, 2720, 3400};
+static const uint8_t band_leds[BAND_COUNT] = {0x00, 0x02, 0x06, 0x0E, 0x1E, 0x3E};
+
+/* Time-reversed, word aligned (filter.h). A symmetric filter reads the same either way */
+static const q15_t fir_coeffs[FIR_TAPS] __attribute__((aligned(4))) =
+{
+  Q15(0.125), Q15(0.125), Q15(0.125), Q15(0.125),
+  Q15(0.125), Q15(0.125), Q15(0.125), Q15(0.125)
+};
+static q15_t fir_state[FIR_STATE_SIZE(FIR_TAPS, ADC_SCAN_STEPS)];
+static FirQ15 fir;
+
+static volatile uint32_t bench_count;
+static volatile uint32_t bench_first;
+static volatile uint32_t bench_last;
+static volatile uint32_t bench_min;
+static volatile uint32_t bench_max;
 
 int main(void)
 {
 
   PortE_Init();
+  Bench_ADC();
+  adcBandInit(ADC_CHANNEL, band_thresholds, BAND_COUNT - 1, BAND_HYSTERESIS, BAND_RATE_HZ,
+              ADC_Band);
 
   while(1)
   {
-    if(adc_value < 680)
-    {
-      GPIOE->DATA &= ~0x3E;     // Turn off all LEDs
-    }
-    else if((680 <= adc_value) && (adc_value < 1360))
-    {
-      GPIOE->DATA |= 0x02;      // Turn on first LED
-      GPIOE->DATA &= 0x02;      // Turn off the other LEDs
-    }
-    else if((1360 <= adc_value) && (adc_value < 2040))
-    {
-      GPIOE->DATA |= 0x06;      // Turn on the first 2 LEDs
-      GPIOE->DATA &= 0x06;      // Turn off the other LEDs
-    }
-    else if((2040 <= adc_value) && (adc_value < 2720))
-    {
-      GPIOE->DATA |= 0x0E;      // Turn on the first 3 LEDs
-      GPIOE->DATA &= 0x0E;      // Turn off the other LEDs
-    }
-    else if((2720 <= adc_value) && (adc_value < 3400))
-    {
-      GPIOE->DATA |= 0x1E;      // Turnn on the first 4 LEDs
-      GPIOE->DATA &= 0x1E;      // Turn off the other LEDs
-    }
-    else if(3400 <= adc_value)
-    {
-      GPIOE->DATA |= 0x3E;      // Turn on all LEDs
-    }
+    __WFI();                  // Sleep until the next band change
   }
 
   return 0;
@@ -81,37 +133,117 @@ void PortE_Init(void)
  */
 {
   SYSCTL->RCGCGPIO |= 0x10;               // Enable an provide clock to port E in run mode
-  SYSCTL->RCGCADC |= 0x01;                // Enable and provide clock for ADC module 0 (ADC0)
 
   GPIOE->DIR |= 0x3E;                     // Set directions of pins PE1:5 to output
   GPIOE->AFSEL |= 0x01;                   // Enable alternate function for pin PE0 (AIN3)
   GPIOE->DEN |= 0x3E;                     // Enable digital function for pins PE1:5
   GPIOE->DEN &= ~0x01;                    // Disable digital function for pin PE0 (AIN3)
   GPIOE->AMSEL |= 0x01;                   // Enable analog function for pin PE0 (AIN3)
+}
 
-  ADC0->ACTSS &= ~(1<<3);                 // Disable Sample Sequencer 3 (SS3) during configuration
-  ADC0->EMUX &= ~0xF000;                  // Conversion event trigger initialized by software
-  ADC0->SSMUX3 |= 0x03;                   // Get input sample from channel AIN3 (PE0)
-  ADC0->SSCTL3 |= 0x06;                   // Take sample one at a time, set flag at first sample
+void Bench_ADC(void)
+/*
+ * @BRIEF:          Measures the rate and jitter of BENCH_SAMPLES interrupts with software
+ *                  triggering, with the timer trigger and with the timer trigger and SS0
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
 
-  ADC0->IM |= (1<<3);                     // Unmask ADC0 SS3 interrupt
-  NVIC->ISER[0] |= (1<<17);               // Enable interrupt for ADC0 SS3 (IRQ17)
-  ADC0->ACTSS |= (1<<3);                  // Enable SS3 logic 
-  ADC0->PSSI |= (1<<3);                   // Enable conversion or start sampling data
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     // Enable the DWT
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (uint32_t mode = 0; mode < BENCH_MODES; mode++)
+  {
+    volatile BenchAdc *result = &bench_adc[mode];
+    uint32_t mean;
+
+    bench_count = 0;
+    bench_min = 0xFFFFFFFF;
+    bench_max = 0;
+    if (mode == BENCH_SOFTWARE) {adcInit(ADC_CHANNEL, 0, ADC_Sample);}
+    else if (mode == BENCH_TIMER) {adcInit(ADC_CHANNEL, ADC_RATE_HZ, ADC_Sample);}
+    else
+    {
+      firInit(&fir, fir_coeffs, FIR_TAPS, fir_state, ADC_SCAN_STEPS);
+      adcScanInit(scan_channels, ADC_SCAN_STEPS, ADC_AVERAGING, ADC_RATE_HZ / ADC_SCAN_STEPS,
+                  ADC_Scan);
+    }
+    while (bench_count < BENCH_SAMPLES);
+    adcStop();
+
+    mean = (bench_last - bench_first) / (BENCH_SAMPLES - 1);
+    result->rate_hz = ADC_SYSCLK_HZ / mean;
+    result->min_cycles = bench_min;
+    result->max_cycles = bench_max;
+    result->jitter_cycles = bench_max - bench_min;
+  }
 }
 
-void ADC0SS3_Handler(void)
+void ADC_Sample(uint16_t sample)
 /*
- * @BRIEF:          Interrupt handler for ADC0 SS3
- *                  Reads the result from the Analog to Digital Converter
- *                  and stores it in the global variable adc_value
+ * @BRIEF:          Called with every conversion result from the ADC0 SS3 interrupt handler,
+ *                  or with the newest filtered one of every sequence from ADC_Scan(). Stores
+ *                  the result in adc_value and times the first BENCH_SAMPLES calls.
  *
- * @ARGUMENTS:      None
+ * @ARGUMENTS:      uint16_t sample:        Conversion result
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t now = DWT->CYCCNT;
+
+  adc_value = sample;
+
+  if (bench_count >= BENCH_SAMPLES) {return;}
+  if (bench_count == 0)
+  {
+    bench_first = now;
+  }
+  else
+  {
+    uint32_t interval = now - bench_last;
+
+    if (interval < bench_min) {bench_min = interval;}
+    if (interval > bench_max) {bench_max = interval;}
+  }
+  bench_last = now;
+  bench_count++;
+}
+
+void ADC_Scan(const uint16_t *samples, uint32_t count)
+/*
+ * @BRIEF:          Called with every sequence, from the ADC0 SS0 interrupt handler. Runs the
+ *                  sequence through the FIR filter and passes the newest filtered sample (the
+ *                  last one) to ADC_Sample().
+ *
+ * @ARGUMENTS:      const uint16_t *samples:    Conversion results
+ *                  uint32_t count:             Number of results
+ *
+ * @RETURNS:        None
+ */
+{
+  q15_t block[ADC_SCAN_STEPS];
+
+  if (count == 0 || count > ADC_SCAN_STEPS) {return;}
+
+  for (uint32_t i = 0; i < count; i++) {block[i] = (q15_t)(samples[i] << 3);}   // 12 bits to Q15
+  firProcess(&fir, block, block, count);
+  ADC_Sample((uint16_t)block[count - 1] >> 3);
+}
+
+void ADC_Band(uint8_t band)
+/*
+ * @BRIEF:          Called with every new band from the ADC0 SS2 interrupt handler. Turns on the
+ *                  LEDs of the band.
+ *
+ * @ARGUMENTS:      uint8_t band:           Band of the potentiometer, 0 to BAND_COUNT - 1
  *
  * @RETURNS:        None
  */
 {
-  adc_value = ADC0->SSFIFO3;              // Read conversion result from SS3 FIFO
-  ADC0->ISC |= 0x08;                      // Clear "conversion completed" interrupt flag
-  ADC0->PSSI |= (1<<3);                   // Enable conversion or start sampling data
+  GPIO_WRITE(GPIOE, LED_PINS, band_leds[band]);
 }
@@ -0,0 +1,114 @@
+/*
+ * @FILENAME:           bargraph.c
+ *
+ * @DESCRIPTION:        Threshold to bar graph mapping, see bargraph.h.
+ *
+ *                      Bits 9:2 of the address of GPIODATA mask the bits that a write changes,
+ *                      so the pins of the bar are written with a plain store to
+ *                      GPIODATA + (pins << 2): one bus write instead of the read-modify-write of
+ *                      GPIODATA, and the outputs of the table only need the bits of the bar.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#include "bargraph.h"
+
+int bargraphInit(Bargraph *bar, const uint32_t *thresholds, const uint8_t *outputs, uint8_t count,
+                 uint32_t hysteresis, GPIOA_Type *port, uint8_t pins)
+/*
+ * @BRIEF:          Configures a bar graph. Nothing is written until the first
+ *                  bargraphUpdate().
+ *
+ * @ARGUMENTS:      Bargraph *bar:                  Bar graph to configure
+ *                  const uint32_t *thresholds:     Band edges in increasing order (not copied)
+ *                  const uint8_t *outputs:         Pin values of bands 0 to count (not copied)
+ *                  uint8_t count:                  Number of thresholds, 1 to
+ *                                                  BARGRAPH_MAX_THRESHOLDS
+ *                  uint32_t hysteresis:            How far past a threshold the value must go to
+ *                                                  leave the current band
+ *                  GPIOA_Type *port:               GPIO port of the bar (GPIOA to GPIOF)
+ *                  uint8_t pins:                   Mask of the pins of the bar, which must be
+ *                                                  outputs
+ *
+ * @RETURNS:        0 if configured, 1 if an argument is wrong
+ */
+{
+  if (bar == 0 || thresholds == 0 || outputs == 0 || count == 0 ||
+      count > BARGRAPH_MAX_THRESHOLDS || port == 0 || pins == 0)
+  {
+    return 1;
+  }
+  for (uint32_t i = 1; i < count; i++)
+  {
+    if (thresholds[i] <= thresholds[i - 1]) {return 1;}
+  }
+
+  bar->thresholds = thresholds;
+  bar->outputs = outputs;
+  bar->data = (volatile uint32_t *)((uintptr_t)port + ((uint32_t)pins << 2));
+  bar->hysteresis = hysteresis;
+  bar->count = count;
+  bar->band = BARGRAPH_NONE;
+
+  return 0;
+}
+
+uint8_t bargraphBand(const Bargraph *bar, uint32_t value)
+/*
+ * @BRIEF:          Finds the band of a value, without hysteresis
+ *
+ * @ARGUMENTS:      const Bargraph *bar:    Bar graph
+ *                  uint32_t value:         Value to look up
+ *
+ * @RETURNS:        Number of thresholds up to the value, 0 to count
+ */
+{
+  uint32_t low = 0;
+  uint32_t high = bar->count;
+
+  while (low < high)                        // First threshold above the value
+  {
+    uint32_t mid = (low + high) >> 1;
+
+    if (bar->thresholds[mid] <= value) {low = mid + 1;}
+    else {high = mid;}
+  }
+
+  return low;
+}
+
+int bargraphUpdate(Bargraph *bar, uint32_t value)
+/*
+ * @BRIEF:          Moves the bar graph to the band of a value. The pins are only written if
+ *                  the band changes, and the current band only changes if the value is more
+ *                  than the hysteresis out of it.
+ *
+ * @ARGUMENTS:      Bargraph *bar:          Bar graph
+ *                  uint32_t value:         New value
+ *
+ * @RETURNS:        1 if the band changed, 0 otherwise
+ */
+{
+  uint8_t band = bar->band;
+
+  if (band != BARGRAPH_NONE)
+  {
+    uint32_t h = bar->hysteresis;
+    int below = (band > 0) && (value + h < bar->thresholds[band - 1]);
+    int above = (band < bar->count) && (value >= bar->thresholds[band] + h);
+
+    if (!below && !above) {return 0;}
+  }
+
+  band = bargraphBand(bar, value);
+  if (band == bar->band) {return 0;}
+
+  bar->band = band;
+  *bar->data = bar->outputs[band];          // Single masked write, the other pins keep their value
+
+  return 1;
+}
@@ -4,6 +4,10 @@
  * @DESCRIPTION:        This application "accurately" (lol no) measures distance
  *                      and lights up a series of LEDs based on distance measured.
  *
+ *                      The distance bands are a table (bargraph.h), in increasing order of
+ *                      distance and decreasing number of LEDs: the LEDs are only written when
+ *                      the band changes, in a single write.
+ *
  * @HARDWARE:           - PB1 -> HC-SR04 ultrasonic sensor (Trigger)
  *                      - PB6 -> HC-SR04 ultrasonic sensor (Echo)
  *
@@ -22,6 +26,20 @@
 
 #include <TM4C123GH6PM.h>
 #include <stdio.h>
+#include "fixed.h"
+#include "bargraph.h"
+#include "gpio.h"
+
+#define BAND_THRESHOLDS   5
+#define BAND_HYSTERESIS   2           /* cm */
+#define LED_PINS          0x3E        /* PE1:5 */
+
+/* 10625 / 10^7 cm per timer tick; fixScale() matches the division for every 16-bit capture */
+static const uint32_t cm_per_tick = FIX_RECIPROCAL(10625, 10000000);
+
+/* 2:50, 51:100, 101:150, 151:200, 201:250 and over 250 cm */
+static const uint32_t band_thresholds[BAND_THRESHOLDS] = {51, 101, 151, 201, 251};
+static const uint8_t band_leds[BAND_THRESHOLDS + 1] = {0x3E, 0x1E, 0x0E, 0x06, 0x02, 0x00};
 
 void system_Init(void);
 void portE_Init(void);
@@ -39,48 +57,28 @@ int main(void)
 
   uint32_t wave_time;
   uint32_t distance;
+  Bargraph leds;
+
+  bargraphInit(&leds, band_thresholds, band_leds, BAND_THRESHOLDS, BAND_HYSTERESIS, GPIOE,
+               LED_PINS);
 
   while(1)
   {
 
     // Send ultrasonic wave for 10 microseconds
-    GPIOB->DATA |= 0x02;                          // Start sending wave
+    GPIO_SET(GPIOB, GPIO_PIN(1));                 // Start sending wave
     Timer1A_delay10microsec();                    // Wait 10 microseconds    
-    GPIOB->DATA &= ~0x02;                         // Stop sending wave
+    GPIO_CLEAR(GPIOB, GPIO_PIN(1));               // Stop sending wave
 
     wave_time = Timer0A_CaptureWaveTime();        // Store time it took for the wave to travel
-    distance = (wave_time * 10625)/10000000;      // Convert time traveled into centimeters traveled
+    distance = fixScale(wave_time, cm_per_tick);  // Convert time traveled into centimeters traveled
 
-    if(250 < distance)
-    {
-      GPIOE->DATA &= ~0x3E;                       // Turn off all LEDs
-    }
-    else if((250 >= distance) && (distance > 200))
-    {
-      GPIOE->DATA |= 0x02;                        // Turn on first LED
-      GPIOE->DATA &= 0x02;                        // Turn off the other LEDs
-    }
-    else if((200 >= distance) && (distance > 150))
-    {
-      GPIOE->DATA |= 0x06;                        // Turn on the first 2 LEDs
-      GPIOE->DATA &= 0x06;                        // Turn off the other LEDs
-    }
-    else if((150 >= distance) && (distance > 100))
-    {
-      GPIOE->DATA |= 0x0E;                        // Turn on the first 3 LEDs
-      GPIOE->DATA &= 0x0E;                        // Turn off the other LEDs
-    }
-    else if((100 >= distance) && (distance > 50))
-    {
-      GPIOE->DATA |= 0x1E;                        // Turnn on the first 4 LEDs
-      GPIOE->DATA &= 0x1E;                        // Turn off the other LEDs
-    }
-    else if((50 >= distance) && (distance > 1))
+    if(distance > 1)                              // 0 or 1 cm is a missed echo
     {
-      GPIOE->DATA |= 0x3E;                        // Turn on all LEDs
+      bargraphUpdate(&leds, distance);
     }
 
-    for(int i = 0; i < 10000; i++)                // Delay
+    for(int i = 0; i < 10000; i++);               // Delay
   }
 
   return 0;
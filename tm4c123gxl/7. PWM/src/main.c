@@ -87,7 +87,7 @@ void portB_init(void)
   GPIOB->IEV |= 0x01;                         // Interrupt in PB0 triggered by rising edge
   GPIOB->ICR |= 0x01;                         // Clear prior interrupt flags
   GPIOB->IM |= 0x01;                          // Unmask interrupt in PB0 (Enable interrupt)
-  NVIC->ISER[0] |= (1<<1);                    // Enable port E interrupt IRQ01
+  NVIC_EnableIRQ(GPIOB_IRQn);                 // Enable port B interrupt (IRQ1)
 
   GPIOB->DEN |= 0x47;                         // Enable digital fucntion in PB(0:2,6)
 
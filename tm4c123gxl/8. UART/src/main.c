@@ -5,6 +5,9 @@
  *                      through serial communication (UART) and lights up a series
  *                      of LEDs based on the temperature received of up to 89ºC.
  *
+ *                      The temperature ranges are a table (bargraph.h): the LEDs are only
+ *                      written when the range changes, in a single write.
+ *
  * @HARDWARE:           PA0 -> UART0 Rx (Built-in)
  *                      PA1 -> UART0 Tx (Built-in)
  *                      PE0 -> Green LED
@@ -21,6 +24,15 @@
  */
 
 #include <TM4C123GH6PM.h>
+#include "bargraph.h"
+
+#define BAND_THRESHOLDS   5
+#define LED_PINS          0x1F        /* PE0:4 */
+
+/* < 50, 50:59, 60:69, 70:79, 80:89 ºC, and anything else */
+static const uint32_t band_thresholds[BAND_THRESHOLDS] = {'5', '6', '7', '8', '9'};
+static const uint8_t band_leds[BAND_THRESHOLDS + 1] = {0x01, 0x02, 0x06, 0x0E, 0x1E, 0x01};
+static Bargraph leds;
 
 void UART0_init(void);
 void GPIOE_init(void);
@@ -33,9 +45,13 @@ int main(void)
   UART0_init();
   GPIOE_init();
 
+  // All the work is done in UART0_Handler: sleep with WFI, and go straight back to sleep
+  // when the handler returns instead of resuming this loop
+  SCB->SCR |= SCB_SCR_SLEEPONEXIT_Msk;
+
   while(1)
   {
-    // Wait for interrupt
+    __WFI();                                    // Wait for interrupt in sleep mode
   }
 
   return 0;
@@ -85,7 +101,7 @@ void UART0_init(void)
   UART0->ICR|= 0x10;                            // Clear receive interrupt flag
   UART0->IM |= 0x10;                            // Unmask receive interrupt
 
-  NVIC->ISER[0] |= (1<<5);                      // Enable UART0 interrupt in vector table (IRQ5)
+  NVIC_EnableIRQ(UART0_IRQn);                   // Enable UART0 interrupt in vector table (IRQ5)
 
   UART0->CTL |= 0x0301;                         // Enable UART module 0, Rx and Tx
 }
@@ -99,6 +115,8 @@ void GPIOE_init(void)
 
   GPIOE->DIR |= 0x1F;                           // Define pins PE(0:4) as outputs
   GPIOE->DEN |= 0x1F;                           // Enable digital I/O for pins PE(0:4)
+
+  bargraphInit(&leds, band_thresholds, band_leds, BAND_THRESHOLDS, 0, GPIOE, LED_PINS);
 }
 
 void UART0_Handler(void)
@@ -140,29 +158,5 @@ void Temperature_Output(unsigned char temperature)
  * @ARGUMENTS:      unsigned_char temperature -> Temperature to show in the LEDs
  */
 {
-  if(temperature == '5')              // 50:59 ºC
-  {
-    GPIOE->DATA |= 0x02;
-    GPIOE->DATA &= 0x02;
-  }
-  else if(temperature == '6')         // 60:69 ºC
-  {
-    GPIOE->DATA |= 0x06;
-    GPIOE->DATA &= 0x06;
-  }
-  else if(temperature == '7')         // 70:79 ºC
-  {
-    GPIOE->DATA |= 0x0E;
-    GPIOE->DATA &= 0x0E;
-  }
-  else if(temperature == '8')         // 80:89 ºC
-  {
-    GPIOE->DATA |= 0x1E;
-    GPIOE->DATA &= 0x1E; 
-  }
-  else                                // < 50 ºC
-  {
-    GPIOE->DATA |= 0x01;
-    GPIOE->DATA &= 0x01;
-  }
+  bargraphUpdate(&leds, temperature);
 }
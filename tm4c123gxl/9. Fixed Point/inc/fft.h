@@ -0,0 +1,54 @@
+/*
+ * @FILENAME:           fft.h
+ *
+ * @DESCRIPTION:        In-place fixed-point complex FFT, to analyze the spectrum of a block of
+ *                      samples on the microcontroller instead of sending them out.
+ *
+ *                      - Radix-4 decimation in frequency, with one radix-2 stage first when the
+ *                        number of points is not a power of 4 (128, 512).
+ *                      - Q15: every complex sample is a pair {re, im} packed in a word, so the
+ *                        butterflies use the halving dual 16-bit instructions (SHADD16,
+ *                        SHSUB16, SHASX, SHSAX) and the twiddle products SMUAD and SMUSDX.
+ *                      - Q31: the same algorithm with 64-bit products (SMULL), for a higher
+ *                        dynamic range at twice the memory.
+ *
+ *                      Every stage divides by its radix so that nothing overflows: the result
+ *                      is the DFT divided by the number of points, and the bins come out in
+ *                      order (the bit reversal is part of the transform).
+ *
+ *                      The buffer holds 2 * points values {re0, im0, re1, im1, ...}: a real
+ *                      signal of N samples needs 4 * N bytes in Q15 and 8 * N in Q31 (8 KB for
+ *                      a 1024-point Q31 transform out of the 32 KB of SRAM). The twiddle factors
+ *                      are constant tables in flash, shared by every size.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _FFT_H_
+#define _FFT_H_
+
+#include <stdint.h>
+#include "fixed.h"
+
+#define FFT_MIN_POINTS      16
+#define FFT_MAX_POINTS      1024
+
+/*
+ * {cos, sin} of 2 * pi * k / FFT_MAX_POINTS for k = 0 .. FFT_MAX_POINTS - 1 (one full turn),
+ * word aligned. Also useful to generate test tones.
+ */
+extern const q15_t fft_twiddle_q15[2 * FFT_MAX_POINTS];
+extern const q31_t fft_twiddle_q31[2 * FFT_MAX_POINTS];
+
+int fftQ15(q15_t *data, uint32_t points);
+int fftQ31(q31_t *data, uint32_t points);
+void fftMagQ15(const q15_t *data, q15_t *mag, uint32_t bins);
+void fftMagQ31(const q31_t *data, q31_t *mag, uint32_t bins);
+uint32_t fftPeakQ15(const q15_t *mag, uint32_t first, uint32_t last);
+uint32_t fftPeakQ31(const q31_t *mag, uint32_t first, uint32_t last);
+
+#endif
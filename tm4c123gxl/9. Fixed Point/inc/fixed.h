@@ -0,0 +1,135 @@
+/*
+ * @FILENAME:           fixed.h
+ *
+ * @DESCRIPTION:        Fixed-point arithmetic with the DSP instructions of the Cortex-M4.
+ *
+ *                      - Q15 (int16_t) and Q31 (int32_t) fractions in [-1, 1). Additions,
+ *                        subtractions and products saturate (QADD, QSUB, SSAT) instead of
+ *                        wrapping around, so an overflow gives the closest value instead of
+ *                        one with the opposite sign.
+ *                      - Scaling by a constant ratio num / den with a multiplication by its
+ *                        reciprocal (UMULL) instead of a division, which is slower (UDIV takes
+ *                        up to 12 cycles) and makes x * num overflow 32 bits for large x.
+ *
+ *                      Every function is inline, so this header can be copied into any project
+ *                      on its own. The vector functions are in fixvec.h.
+ *
+ *                      The intrinsics are the ones of the CMSIS headers (cmsis_gcc.h), which are
+ *                      only defined when the compiler targets a core with the DSP extension
+ *                      (-mcpu=cortex-m4).
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _FIXED_H_
+#define _FIXED_H_
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+#define Q15_MAX           ((q15_t)0x7FFF)
+#define Q15_MIN           ((q15_t)0x8000)
+#define Q31_MAX           ((q31_t)0x7FFFFFFF)
+#define Q31_MIN           ((q31_t)0x80000000)
+
+/* Constant conversions from a fraction in [-1, 1), e.g. Q15(0.5), evaluated by the compiler */
+#define Q15(x)            ((q15_t)(((x) >= 1.0) ? 0x7FFF : (x) * 32768.0))
+#define Q31(x)            ((q31_t)(((x) >= 1.0) ? 0x7FFFFFFF : (x) * 2147483648.0))
+
+/*
+ * Reciprocal of den scaled by 2^32 times num, for fixScale(). num must be smaller than den.
+ * Rounded up so that fixScale() never returns less than x * num / den. Must be used with
+ * constant arguments (e.g. in a static const initializer) so that the compiler does the 64-bit
+ * division.
+ */
+#define FIX_RECIPROCAL(num, den) \
+  ((uint32_t)((((uint64_t)(num) << 32) + (uint64_t)(den) - 1) / (uint64_t)(den)))
+
+static inline q15_t q15Add(q15_t a, q15_t b)
+/*
+ * @BRIEF:          Saturating Q15 addition
+ */
+{
+  return (q15_t)__SSAT((int32_t)a + b, 16);
+}
+
+static inline q15_t q15Sub(q15_t a, q15_t b)
+/*
+ * @BRIEF:          Saturating Q15 subtraction
+ */
+{
+  return (q15_t)__SSAT((int32_t)a - b, 16);
+}
+
+static inline q15_t q15Mul(q15_t a, q15_t b)
+/*
+ * @BRIEF:          Saturating Q15 product (only -1 * -1 saturates)
+ */
+{
+  return (q15_t)__SSAT(((int32_t)a * b) >> 15, 16);
+}
+
+static inline q31_t q31Add(q31_t a, q31_t b)
+/*
+ * @BRIEF:          Saturating Q31 addition
+ */
+{
+  return __QADD(a, b);
+}
+
+static inline q31_t q31Sub(q31_t a, q31_t b)
+/*
+ * @BRIEF:          Saturating Q31 subtraction
+ */
+{
+  return __QSUB(a, b);
+}
+
+static inline q31_t q31Mul(q31_t a, q31_t b)
+/*
+ * @BRIEF:          Saturating Q31 product. The high word of the 64-bit product (SMULL) is a
+ *                  Q30 value, doubled with a saturating addition (only -1 * -1 saturates).
+ */
+{
+  q31_t high = (q31_t)(((int64_t)a * b) >> 32);
+
+  return __QADD(high, high);
+}
+
+static inline q15_t q31ToQ15(q31_t a)
+/*
+ * @BRIEF:          Q31 to Q15, truncating the 16 least significant bits
+ */
+{
+  return (q15_t)(a >> 16);
+}
+
+static inline q31_t q15ToQ31(q15_t a)
+/*
+ * @BRIEF:          Q15 to Q31
+ */
+{
+  return (q31_t)a << 16;
+}
+
+static inline uint32_t fixScale(uint32_t x, uint32_t reciprocal)
+/*
+ * @BRIEF:          Computes x * num / den, rounded down, as the high word of a 32x32 bit
+ *                  product (a single UMULL), with reciprocal = FIX_RECIPROCAL(num, den).
+ *
+ *                  The result may be 1 over the exact one for large x, since the reciprocal
+ *                  is rounded: it is exact for every x below 2^32 / den, and in practice for
+ *                  much larger values, so check the range used.
+ */
+{
+  return (uint32_t)(((uint64_t)x * reciprocal) >> 32);
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*
+ * @FILENAME:           fixvec.h
+ *
+ * @DESCRIPTION:        Q15 vector operations with the dual 16-bit (SIMD) instructions of the
+ *                      Cortex-M4: every instruction works on a pair of samples packed in a word,
+ *                      so the vectors must be word aligned. An odd last sample is processed on
+ *                      its own.
+ *
+ *                      - q15VecAdd():    QADD16, two saturating additions per cycle.
+ *                      - q15VecScale():  SMULBB/SMULTB through SMUAD(X), then SSAT and PKHBT.
+ *                      - q15Dot():       SMLALD, two multiply-accumulates per instruction into
+ *                                        a 64-bit accumulator, which cannot overflow for any
+ *                                        practical length.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _FIXVEC_H_
+#define _FIXVEC_H_
+
+#include <stdint.h>
+#include "fixed.h"
+
+/* A pair of Q15 samples read or written as one word */
+typedef uint32_t q15x2_t __attribute__((may_alias));
+
+void q15VecAdd(q15_t *dst, const q15_t *a, const q15_t *b, uint32_t n);
+void q15VecScale(q15_t *dst, const q15_t *src, q15_t scale, uint32_t n);
+q31_t q15Dot(const q15_t *a, const q15_t *b, uint32_t n);
+
+#endif
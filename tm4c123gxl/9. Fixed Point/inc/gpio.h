@@ -0,0 +1,49 @@
+/*
+ * @FILENAME:           gpio.h
+ *
+ * @DESCRIPTION:        Pin access through the masked GPIODATA aperture.
+ *
+ *                      GPIODATA is mirrored over the first 1 KB of every GPIO port: bits 9:2 of
+ *                      the address are a mask of the pins that an access affects. A write
+ *                      changes only the pins of the mask and a read returns 0 for every other
+ *                      pin, so setting or clearing pins is a single store, with no read of
+ *                      GPIODATA, and it cannot overwrite a pin that an interrupt handler
+ *                      changes in the middle (the |= and &= read-modify-write sequences can).
+ *
+ *                      The macros build the address from the port and the mask, so with
+ *                      constant arguments the address is a constant of the program and the
+ *                      access is one load of the address and one store, at any optimization
+ *                      level. They work in C and C++ and with masks known at run time too.
+ *
+ *                      - GPIO_SET(GPIOE, GPIO_PIN(1)):             PE1 high
+ *                      - GPIO_CLEAR(GPIOE, 0x06):                  PE1 and PE2 low
+ *                      - GPIO_WRITE(GPIOE, 0x3E, leds):            PE1:5 to bits 5:1 of leds
+ *                      - GPIO_READ(GPIOE, GPIO_PIN(0)):            PE0, 0 or 0x01
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#ifndef _GPIO_H_
+#define _GPIO_H_
+
+#include <stdint.h>
+
+#define GPIO_PIN(n)                 (1U << (n))
+
+/* GPIODATA seen through the pins of mask (0x01 to 0xFF) */
+#define GPIO_DATA(port, mask)       (*(volatile uint32_t *)((uintptr_t)(port) + \
+                                                            (((uint32_t)(mask) & 0xFF) << 2)))
+
+#define GPIO_SET(port, mask)        (GPIO_DATA(port, mask) = 0xFF)
+#define GPIO_CLEAR(port, mask)      (GPIO_DATA(port, mask) = 0)
+#define GPIO_WRITE(port, mask, value) (GPIO_DATA(port, mask) = (value))
+#define GPIO_READ(port, mask)       (GPIO_DATA(port, mask))
+
+/* A read and a write, but both through the mask: the other pins are not touched */
+#define GPIO_TOGGLE(port, mask)     (GPIO_DATA(port, mask) ^= 0xFF)
+
+#endif
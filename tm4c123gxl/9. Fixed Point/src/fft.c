@@ -0,0 +1,400 @@
+/*
+ * @FILENAME:           fft.c
+ *
+ * @DESCRIPTION:        Fixed-point complex FFT and spectrum helpers (see fft.h).
+ *
+ *                      Every radix-4 stage splits the buffer in groups of len samples and
+ *                      combines the four quarters of each group. The butterfly outputs are
+ *                      stored in the order 0, 2, 1, 3, which together with the radix-2 stage
+ *                      (even bins in the first half, odd in the second) leaves the bins in bit
+ *                      reversed order for any power of 2, so a single RBIT based pass sorts
+ *                      them. The twiddle factors of a stage with groups of len samples are the
+ *                      table entries k * 1024 / len.
+ *
+ *                      The last radix-4 stage (len 4) has no twiddle factors but 1, so it skips
+ *                      the products.
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+#include "fixed.h"
+#include "fixvec.h"
+#include "fft.h"
+
+static uint32_t fftLog2(uint32_t points)
+/*
+ * @BRIEF:          Number of bits of the bin index
+ *
+ * @ARGUMENTS:      uint32_t points:        Number of points
+ *
+ * @RETURNS:        log2(points), or 0 if points is not a supported power of 2
+ */
+{
+  if (points < FFT_MIN_POINTS || points > FFT_MAX_POINTS || (points & (points - 1)) != 0)
+  {
+    return 0;
+  }
+
+  return 31 - __CLZ(points);
+}
+
+static inline uint32_t fftTwiddleQ15(uint32_t x, uint32_t w)
+/*
+ * @BRIEF:          x * (cos - j sin), with w = {cos, sin}. The magnitude of x must be below 1.
+ */
+{
+  int32_t re = (int32_t)__SMUAD(x, w);          /* re * cos + im * sin */
+  int32_t im = (int32_t)__SMUSDX(w, x);         /* im * cos - re * sin */
+
+  return __PKHBT(re >> 15, im >> 15, 16);
+}
+
+static void fftReverseQ15(q15x2_t *x, uint32_t bits)
+/*
+ * @BRIEF:          Bit reversal permutation of 2^bits complex samples
+ */
+{
+  for (uint32_t i = 1; i < (1U << bits) - 1; i++)
+  {
+    uint32_t j = __RBIT(i) >> (32 - bits);
+
+    if (i < j)
+    {
+      uint32_t tmp = x[i];
+      x[i] = x[j];
+      x[j] = tmp;
+    }
+  }
+}
+
+int fftQ15(q15_t *data, uint32_t points)
+/*
+ * @BRIEF:          In-place forward FFT, divided by the number of points
+ *
+ * @ARGUMENTS:      q15_t *data:            2 * points values {re, im}, word aligned. The
+ *                                          magnitude of every sample must be below 1 (true for
+ *                                          any real signal)
+ *                  uint32_t points:        Number of points, a power of 2 from FFT_MIN_POINTS
+ *                                          to FFT_MAX_POINTS
+ *
+ * @RETURNS:        0 if transformed, 1 if the number of points is not supported
+ */
+{
+  q15x2_t *x = (q15x2_t *)data;
+  const q15x2_t *twiddle = (const q15x2_t *)fft_twiddle_q15;
+  uint32_t bits = fftLog2(points);
+  uint32_t stride = FFT_MAX_POINTS / points;
+  uint32_t len = points;
+
+  if (bits == 0) {return 1;}
+
+  if (bits & 1)                         /* Radix-2 stage */
+  {
+    uint32_t half = points / 2;
+
+    for (uint32_t n = 0; n < half; n++)
+    {
+      uint32_t a = x[n];
+      uint32_t b = x[n + half];
+
+      x[n] = __SHADD16(a, b);
+      x[n + half] = fftTwiddleQ15(__SHSUB16(a, b), twiddle[n * stride]);
+    }
+    len = half;
+    stride *= 2;
+  }
+
+  for (; len >= 4; len /= 4, stride *= 4)
+  {
+    uint32_t q = len / 4;
+
+    for (uint32_t n = 0; n < q; n++)
+    {
+      uint32_t w1 = twiddle[n * stride];
+      uint32_t w2 = twiddle[2 * n * stride];
+      uint32_t w3 = twiddle[3 * n * stride];
+
+      for (q15x2_t *g = &x[n]; g < &x[points]; g += len)
+      {
+        uint32_t t0 = __SHADD16(g[0], g[2 * q]);
+        uint32_t t1 = __SHSUB16(g[0], g[2 * q]);
+        uint32_t t2 = __SHADD16(g[q], g[3 * q]);
+        uint32_t t3 = __SHSUB16(g[q], g[3 * q]);
+        uint32_t y1 = __SHSAX(t1, t3);          /* (t1 - j t3) / 2 */
+        uint32_t y2 = __SHSUB16(t0, t2);
+        uint32_t y3 = __SHASX(t1, t3);          /* (t1 + j t3) / 2 */
+
+        g[0] = __SHADD16(t0, t2);
+        if (q == 1)
+        {
+          g[1] = y2;
+          g[2] = y1;
+          g[3] = y3;
+        }
+        else
+        {
+          g[q] = fftTwiddleQ15(y2, w2);
+          g[2 * q] = fftTwiddleQ15(y1, w1);
+          g[3 * q] = fftTwiddleQ15(y3, w3);
+        }
+      }
+    }
+  }
+
+  fftReverseQ15(x, bits);
+
+  return 0;
+}
+
+static inline void fftTwiddleQ31(q31_t *x, const q31_t *w)
+/*
+ * @BRIEF:          x * (cos - j sin), with w = {cos, sin}, as the high words of SMULL/SMLAL
+ *                  doubled. The magnitude of x must be below 1.
+ */
+{
+  q31_t re = (q31_t)(((int64_t)x[0] * w[0] + (int64_t)x[1] * w[1]) >> 32);
+  q31_t im = (q31_t)(((int64_t)x[1] * w[0] - (int64_t)x[0] * w[1]) >> 32);
+
+  x[0] = re * 2;
+  x[1] = im * 2;
+}
+
+static void fftReverseQ31(q31_t *x, uint32_t bits)
+/*
+ * @BRIEF:          Bit reversal permutation of 2^bits complex samples
+ */
+{
+  for (uint32_t i = 1; i < (1U << bits) - 1; i++)
+  {
+    uint32_t j = __RBIT(i) >> (32 - bits);
+
+    if (i < j)
+    {
+      q31_t re = x[2 * i];
+      q31_t im = x[2 * i + 1];
+
+      x[2 * i] = x[2 * j];
+      x[2 * i + 1] = x[2 * j + 1];
+      x[2 * j] = re;
+      x[2 * j + 1] = im;
+    }
+  }
+}
+
+int fftQ31(q31_t *data, uint32_t points)
+/*
+ * @BRIEF:          In-place forward FFT, divided by the number of points
+ *
+ * @ARGUMENTS:      q31_t *data:            2 * points values {re, im}. The magnitude of every
+ *                                          sample must be below 1 (true for any real signal)
+ *                  uint32_t points:        Number of points, a power of 2 from FFT_MIN_POINTS
+ *                                          to FFT_MAX_POINTS
+ *
+ * @RETURNS:        0 if transformed, 1 if the number of points is not supported
+ */
+{
+  uint32_t bits = fftLog2(points);
+  uint32_t stride = FFT_MAX_POINTS / points;
+  uint32_t len = points;
+
+  if (bits == 0) {return 1;}
+
+  if (bits & 1)                         /* Radix-2 stage */
+  {
+    uint32_t half = points / 2;
+
+    for (uint32_t n = 0; n < half; n++)
+    {
+      q31_t *a = &data[2 * n];
+      q31_t *b = &data[2 * (n + half)];
+      q31_t re = (a[0] >> 1) - (b[0] >> 1);
+      q31_t im = (a[1] >> 1) - (b[1] >> 1);
+
+      a[0] = (a[0] >> 1) + (b[0] >> 1);
+      a[1] = (a[1] >> 1) + (b[1] >> 1);
+      b[0] = re;
+      b[1] = im;
+      fftTwiddleQ31(b, &fft_twiddle_q31[2 * n * stride]);
+    }
+    len = half;
+    stride *= 2;
+  }
+
+  for (; len >= 4; len /= 4, stride *= 4)
+  {
+    uint32_t q = len / 4;
+
+    for (uint32_t n = 0; n < q; n++)
+    {
+      for (q31_t *g = &data[2 * n]; g < &data[2 * points]; g += 2 * len)
+      {
+        q31_t *x0 = &g[0];
+        q31_t *x1 = &g[2 * q];
+        q31_t *x2 = &g[4 * q];
+        q31_t *x3 = &g[6 * q];
+
+        /* Inputs divided by 4 first: the sums of four cannot overflow */
+        q31_t t0r = (x0[0] >> 2) + (x2[0] >> 2), t0i = (x0[1] >> 2) + (x2[1] >> 2);
+        q31_t t1r = (x0[0] >> 2) - (x2[0] >> 2), t1i = (x0[1] >> 2) - (x2[1] >> 2);
+        q31_t t2r = (x1[0] >> 2) + (x3[0] >> 2), t2i = (x1[1] >> 2) + (x3[1] >> 2);
+        q31_t t3r = (x1[0] >> 2) - (x3[0] >> 2), t3i = (x1[1] >> 2) - (x3[1] >> 2);
+
+        x0[0] = t0r + t2r;                      /* Bin 0 */
+        x0[1] = t0i + t2i;
+        x1[0] = t0r - t2r;                      /* Bin 2 */
+        x1[1] = t0i - t2i;
+        x2[0] = t1r + t3i;                      /* Bin 1: t1 - j t3 */
+        x2[1] = t1i - t3r;
+        x3[0] = t1r - t3i;                      /* Bin 3: t1 + j t3 */
+        x3[1] = t1i + t3r;
+
+        if (q != 1)
+        {
+          fftTwiddleQ31(x1, &fft_twiddle_q31[2 * 2 * n * stride]);
+          fftTwiddleQ31(x2, &fft_twiddle_q31[2 * n * stride]);
+          fftTwiddleQ31(x3, &fft_twiddle_q31[2 * 3 * n * stride]);
+        }
+      }
+    }
+  }
+
+  fftReverseQ31(data, bits);
+
+  return 0;
+}
+
+static uint32_t fftSqrt32(uint32_t v)
+/*
+ * @BRIEF:          Integer square root, rounded down, one result bit per iteration
+ */
+{
+  uint32_t root = 0;
+
+  for (uint32_t bit = 1UL << 30; bit != 0; bit >>= 2)
+  {
+    if (v >= root + bit)
+    {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+  }
+
+  return root;
+}
+
+static uint32_t fftSqrt64(uint64_t v)
+/*
+ * @BRIEF:          Integer square root, rounded down, one result bit per iteration
+ */
+{
+  uint64_t root = 0;
+
+  for (uint64_t bit = 1ULL << 62; bit != 0; bit >>= 2)
+  {
+    if (v >= root + bit)
+    {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+  }
+
+  return (uint32_t)root;
+}
+
+void fftMagQ15(const q15_t *data, q15_t *mag, uint32_t bins)
+/*
+ * @BRIEF:          Magnitude of the first bins of a transform, sqrt(re^2 + im^2), saturated
+ *
+ * @ARGUMENTS:      const q15_t *data:      Transform, word aligned
+ *                  q15_t *mag:             bins magnitudes (may not be data)
+ *                  uint32_t bins:          Number of bins, e.g. points / 2 + 1 for a real signal
+ *
+ * @RETURNS:        None
+ */
+{
+  const q15x2_t *x = (const q15x2_t *)data;
+
+  for (uint32_t k = 0; k < bins; k++)
+  {
+    uint32_t root = fftSqrt32(__SMUAD(x[k], x[k]));     /* Q30 -> Q15 */
+
+    mag[k] = (root > Q15_MAX) ? Q15_MAX : (q15_t)root;
+  }
+}
+
+void fftMagQ31(const q31_t *data, q31_t *mag, uint32_t bins)
+/*
+ * @BRIEF:          Magnitude of the first bins of a transform, sqrt(re^2 + im^2), saturated
+ *
+ * @ARGUMENTS:      const q31_t *data:      Transform
+ *                  q31_t *mag:             bins magnitudes (may not be data)
+ *                  uint32_t bins:          Number of bins, e.g. points / 2 + 1 for a real signal
+ *
+ * @RETURNS:        None
+ */
+{
+  for (uint32_t k = 0; k < bins; k++)
+  {
+    int64_t re = data[2 * k];
+    int64_t im = data[2 * k + 1];
+    uint32_t root = fftSqrt64((uint64_t)(re * re) + (uint64_t)(im * im));      /* Q62 -> Q31 */
+
+    mag[k] = (root > (uint32_t)Q31_MAX) ? Q31_MAX : (q31_t)root;
+  }
+}
+
+uint32_t fftPeakQ15(const q15_t *mag, uint32_t first, uint32_t last)
+/*
+ * @BRIEF:          Finds the largest magnitude in a range of bins
+ *
+ * @ARGUMENTS:      const q15_t *mag:       Magnitudes
+ *                  uint32_t first:         First bin searched, e.g. 1 to skip the DC one
+ *                  uint32_t last:          Last bin searched
+ *
+ * @RETURNS:        The bin of the largest magnitude (the first one if there is a tie)
+ */
+{
+  uint32_t peak = first;
+
+  for (uint32_t k = first + 1; k <= last; k++)
+  {
+    if (mag[k] > mag[peak]) {peak = k;}
+  }
+
+  return peak;
+}
+
+uint32_t fftPeakQ31(const q31_t *mag, uint32_t first, uint32_t last)
+/*
+ * @BRIEF:          Finds the largest magnitude in a range of bins
+ *
+ * @ARGUMENTS:      const q31_t *mag:       Magnitudes
+ *                  uint32_t first:         First bin searched, e.g. 1 to skip the DC one
+ *                  uint32_t last:          Last bin searched
+ *
+ * @RETURNS:        The bin of the largest magnitude (the first one if there is a tie)
+ */
+{
+  uint32_t peak = first;
+
+  for (uint32_t k = first + 1; k <= last; k++)
+  {
+    if (mag[k] > mag[peak]) {peak = k;}
+  }
+
+  return peak;
+}
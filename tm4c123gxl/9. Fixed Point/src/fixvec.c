@@ -0,0 +1,94 @@
+/*
+ * @FILENAME:           fixvec.c
+ *
+ * @DESCRIPTION:        Q15 vector operations with the dual 16-bit instructions (see fixvec.h).
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ *
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+#include "fixed.h"
+#include "fixvec.h"
+
+void q15VecAdd(q15_t *dst, const q15_t *a, const q15_t *b, uint32_t n)
+/*
+ * @BRIEF:          Saturating addition of two vectors, dst[i] = a[i] + b[i]
+ *
+ * @ARGUMENTS:      q15_t *dst:         Result (may be a or b)
+ *                  const q15_t *a:     First vector
+ *                  const q15_t *b:     Second vector
+ *                  uint32_t n:         Number of samples
+ *
+ * @RETURNS:        None
+ */
+{
+  q15x2_t *dst2 = (q15x2_t *)dst;
+  const q15x2_t *a2 = (const q15x2_t *)a;
+  const q15x2_t *b2 = (const q15x2_t *)b;
+
+  for (uint32_t i = 0; i < n / 2; i++)
+  {
+    dst2[i] = __QADD16(a2[i], b2[i]);
+  }
+
+  if (n & 1) {dst[n - 1] = q15Add(a[n - 1], b[n - 1]);}
+}
+
+void q15VecScale(q15_t *dst, const q15_t *src, q15_t scale, uint32_t n)
+/*
+ * @BRIEF:          Multiplies a vector by a constant, dst[i] = src[i] * scale, saturating
+ *
+ * @ARGUMENTS:      q15_t *dst:         Result (may be src)
+ *                  const q15_t *src:   Vector
+ *                  q15_t scale:        Factor
+ *                  uint32_t n:         Number of samples
+ *
+ * @RETURNS:        None
+ */
+{
+  q15x2_t *dst2 = (q15x2_t *)dst;
+  const q15x2_t *src2 = (const q15x2_t *)src;
+  uint32_t k = (uint16_t)scale;         /* Factor in the bottom half, 0 in the top half */
+
+  for (uint32_t i = 0; i < n / 2; i++)
+  {
+    int32_t low = __SSAT((int32_t)__SMUAD(src2[i], k) >> 15, 16);     /* bottom * scale */
+    int32_t high = __SSAT((int32_t)__SMUADX(src2[i], k) >> 15, 16);   /* top * scale    */
+
+    dst2[i] = __PKHBT(low, high, 16);
+  }
+
+  if (n & 1) {dst[n - 1] = q15Mul(src[n - 1], scale);}
+}
+
+q31_t q15Dot(const q15_t *a, const q15_t *b, uint32_t n)
+/*
+ * @BRIEF:          Dot product of two vectors
+ *
+ * @ARGUMENTS:      const q15_t *a:     First vector
+ *                  const q15_t *b:     Second vector
+ *                  uint32_t n:         Number of samples
+ *
+ * @RETURNS:        Sum of a[i] * b[i] in Q31, saturated
+ */
+{
+  const q15x2_t *a2 = (const q15x2_t *)a;
+  const q15x2_t *b2 = (const q15x2_t *)b;
+  int64_t acc = 0;                      /* Q30 */
+
+  for (uint32_t i = 0; i < n / 2; i++)
+  {
+    acc = (int64_t)__SMLALD(a2[i], b2[i], (uint64_t)acc);
+  }
+
+  if (n & 1) {acc += (int32_t)a[n - 1] * b[n - 1];}
+
+  if (acc > (int64_t)Q31_MAX / 2) {return Q31_MAX;}
+  if (acc < (int64_t)Q31_MIN / 2) {return Q31_MIN;}
+  return (q31_t)(acc * 2);
+}
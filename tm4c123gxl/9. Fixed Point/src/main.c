@@ -0,0 +1,463 @@
+/*
+ * @FILENAME:           main.c
+ *
+ * @DESCRIPTION:        Benchmark of the fixed-point library (fixed.h, fixvec.h) against plain C
+ *                      integer code and single precision float (FPU) code, measured with the
+ *                      DWT cycle counter:
+ *
+ *                        - Scale:  ultrasonic echo times to centimeters, t * 10625 / 10^7,
+ *                                  as in the Timers application (UDIV vs UMULL vs VCVT/VMUL).
+ *                        - Add:    saturating addition of two Q15 vectors (compare and clamp
+ *                                  vs QADD16 vs float with clamp).
+ *                        - Dot:    dot product of two Q15 vectors (MUL and 64-bit addition vs
+ *                                  SMLALD vs VMLA).
+ *
+ *                      It also measures the cycles per sample of the filters (filter.h) for
+ *                      several FIR lengths and biquad cascades, filtering the second of two
+ *                      blocks so that the history is in use, and the cycles and buffer sizes
+ *                      of the Q15 and Q31 FFTs (fft.h) from 64 to 1024 points. The FFT input is
+ *                      a tone plus noise, whose bin must be the peak of both spectra, and the
+ *                      Q15 spectrum must be within FFT_TOLERANCE of the Q31 one.
+ *
+ *                      The fixed-point results are checked against the plain C ones, and the
+ *                      green LED turns on if they all match. The results are read with the
+ *                      debugger ("print bench_cycles", "print bench_fir_cycles_per_sample",
+ *                      "print bench_biquad_cycles_per_sample", "print bench_fft" and
+ *                      "print bench_errors" in gdb).
+ *
+ * @HARDWARE:           - PF3: Green LED
+ *
+ * @AUTHOR:             Hiram Montejano Gómez
+ * 
+ * @STARTING DATE:      18/10/2026
+ *
+ * @ENDING DATE:        18/10/2026
+ */
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+#include "fixed.h"
+#include "fixvec.h"
+#include "filter.h"
+#include "fft.h"
+#include "gpio.h"
+
+#define BENCH_SAMPLES   256     /* Samples per vector, must be even */
+#define FILTER_BLOCK    64      /* Samples per filter call */
+#define FIR_LENGTHS     4
+#define FIR_MAX_TAPS    64
+#define BIQUAD_CASCADES 3
+#define BIQUAD_MAX      4       /* Maximum number of stages */
+#define FFT_SIZES       5       /* 64 to 1024 points */
+#define FFT_TOLERANCE   16      /* Q15 LSBs between the Q15 and the Q31 transforms */
+
+typedef struct
+{
+  uint32_t points;
+  uint32_t cycles_q15;
+  uint32_t cycles_q31;
+  uint32_t ram_q15;             /* Bytes of the buffer, the transform uses no other RAM */
+  uint32_t ram_q31;
+  uint32_t peak_q15;            /* Bin of the tone, points / 8 + 1 */
+  uint32_t peak_q31;
+} BenchFft;
+
+enum
+{
+  BENCH_SCALE = 0,
+  BENCH_ADD,
+  BENCH_DOT,
+  BENCH_KERNELS
+};
+
+enum
+{
+  BENCH_PLAIN = 0,              /* Plain C integer code */
+  BENCH_FLOAT,                  /* Single precision, FPU */
+  BENCH_FIXED,                  /* fixed.h / fixvec.h */
+  BENCH_IMPLS
+};
+
+static const uint32_t cm_reciprocal = FIX_RECIPROCAL(10625, 10000000);
+
+volatile uint32_t bench_cycles[BENCH_KERNELS][BENCH_IMPLS];
+volatile uint32_t bench_errors;
+volatile float bench_dot_float;       /* Kept so the float loop is not optimized away */
+volatile uint32_t bench_fir_cycles_per_sample[FIR_LENGTHS];
+volatile uint32_t bench_biquad_cycles_per_sample[BIQUAD_CASCADES];
+volatile BenchFft bench_fft[FFT_SIZES];
+
+static const uint16_t fir_taps[FIR_LENGTHS] = {8, 16, 32, 64};
+static const uint8_t biquad_stages[BIQUAD_CASCADES] = {1, 2, 4};
+
+/* Butterworth low-pass at fs / 10 in Q14, the same section repeated in every stage */
+static const q15_t biquad_coeffs[6 * BIQUAD_MAX] __attribute__((aligned(4))) =
+{
+  1105, 0, 2210, 1105, 18727, -6763,
+  1105, 0, 2210, 1105, 18727, -6763,
+  1105, 0, 2210, 1105, 18727, -6763,
+  1105, 0, 2210, 1105, 18727, -6763
+};
+
+static uint32_t echo_time[BENCH_SAMPLES];
+static uint32_t distance[BENCH_IMPLS][BENCH_SAMPLES];
+static q15_t vec_a[BENCH_SAMPLES] __attribute__((aligned(4)));
+static q15_t vec_b[BENCH_SAMPLES] __attribute__((aligned(4)));
+static q15_t sum_plain[BENCH_SAMPLES];
+static q15_t sum_fixed[BENCH_SAMPLES] __attribute__((aligned(4)));
+static float vec_a_f[BENCH_SAMPLES];
+static float vec_b_f[BENCH_SAMPLES];
+static float sum_f[BENCH_SAMPLES];
+static q15_t fir_coeffs[FIR_MAX_TAPS] __attribute__((aligned(4)));
+static q15_t fir_state[FIR_STATE_SIZE(FIR_MAX_TAPS, FILTER_BLOCK)];
+static q15_t biquad_state[BIQUAD_STATE_SIZE(BIQUAD_MAX)] __attribute__((aligned(4)));
+static q15_t filter_out[FILTER_BLOCK];
+static q15_t filter_ref[2 * FILTER_BLOCK];
+static q15_t fft_q15[2 * FFT_MAX_POINTS] __attribute__((aligned(4)));
+static q31_t fft_q31[2 * FFT_MAX_POINTS];
+static q15_t fft_mag_q15[FFT_MAX_POINTS / 2 + 1];
+static q31_t fft_mag_q31[FFT_MAX_POINTS / 2 + 1];
+
+void benchInit(void);
+void benchScale(void);
+void benchAdd(void);
+void benchDot(void);
+void benchFir(void);
+void benchBiquad(void);
+void benchFft(void);
+
+int main(void)
+{
+  SYSCTL->RCGCGPIO |= 0x20;                 // Enable and provide clock to port F
+  GPIOF->DIR |= 0x08;                       // PF3 (green LED) as output
+  GPIOF->DEN |= 0x08;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     // Enable the DWT
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  benchInit();
+  benchScale();
+  benchAdd();
+  benchDot();
+  benchFir();
+  benchBiquad();
+  benchFft();
+
+  if (bench_errors == 0) {GPIO_SET(GPIOF, GPIO_PIN(3));}
+
+  while (1) {}
+
+  return 0;
+}
+
+void benchInit(void)
+/*
+ * @BRIEF:          Fills the inputs with pseudo-random values: 16-bit echo times (the capture
+ *                  timer is 16 bits wide) and full range Q15 samples, so that additions
+ *                  saturate often
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t seed = 12345;
+
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    echo_time[i] = seed >> 16;
+    vec_a[i] = (q15_t)(seed & 0xFFFF);
+    seed = seed * 1664525 + 1013904223;
+    vec_b[i] = (q15_t)(seed >> 16);
+
+    vec_a_f[i] = vec_a[i] / 32768.0f;
+    vec_b_f[i] = vec_b[i] / 32768.0f;
+  }
+}
+
+void benchScale(void)
+/*
+ * @BRIEF:          Echo times to centimeters
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t start;
+
+  start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    distance[BENCH_PLAIN][i] = (echo_time[i] * 10625) / 10000000;
+  }
+  bench_cycles[BENCH_SCALE][BENCH_PLAIN] = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    distance[BENCH_FLOAT][i] = (uint32_t)(echo_time[i] * 0.0010625f);
+  }
+  bench_cycles[BENCH_SCALE][BENCH_FLOAT] = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    distance[BENCH_FIXED][i] = fixScale(echo_time[i], cm_reciprocal);
+  }
+  bench_cycles[BENCH_SCALE][BENCH_FIXED] = DWT->CYCCNT - start;
+
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    if (distance[BENCH_FIXED][i] != distance[BENCH_PLAIN][i]) {bench_errors++;}
+  }
+}
+
+void benchAdd(void)
+/*
+ * @BRIEF:          Saturating vector addition
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t start;
+
+  start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    int32_t sum = (int32_t)vec_a[i] + vec_b[i];
+
+    if (sum > Q15_MAX) {sum = Q15_MAX;}
+    else if (sum < Q15_MIN) {sum = Q15_MIN;}
+    sum_plain[i] = (q15_t)sum;
+  }
+  bench_cycles[BENCH_ADD][BENCH_PLAIN] = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    float sum = vec_a_f[i] + vec_b_f[i];
+
+    if (sum > 1.0f) {sum = 1.0f;}
+    else if (sum < -1.0f) {sum = -1.0f;}
+    sum_f[i] = sum;
+  }
+  bench_cycles[BENCH_ADD][BENCH_FLOAT] = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  q15VecAdd(sum_fixed, vec_a, vec_b, BENCH_SAMPLES);
+  bench_cycles[BENCH_ADD][BENCH_FIXED] = DWT->CYCCNT - start;
+
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    if (sum_fixed[i] != sum_plain[i]) {bench_errors++;}
+  }
+}
+
+void benchDot(void)
+/*
+ * @BRIEF:          Vector dot product
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t start;
+  int64_t acc = 0;
+  q31_t dot_plain;
+  q31_t dot_fixed;
+
+  start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    acc += (int32_t)vec_a[i] * vec_b[i];
+  }
+  if (acc > (int64_t)Q31_MAX / 2) {dot_plain = Q31_MAX;}
+  else if (acc < (int64_t)Q31_MIN / 2) {dot_plain = Q31_MIN;}
+  else {dot_plain = (q31_t)(acc * 2);}
+  bench_cycles[BENCH_DOT][BENCH_PLAIN] = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  float acc_f = 0.0f;
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+  {
+    acc_f += vec_a_f[i] * vec_b_f[i];
+  }
+  bench_dot_float = acc_f;
+  bench_cycles[BENCH_DOT][BENCH_FLOAT] = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  dot_fixed = q15Dot(vec_a, vec_b, BENCH_SAMPLES);
+  bench_cycles[BENCH_DOT][BENCH_FIXED] = DWT->CYCCNT - start;
+
+  if (dot_fixed != dot_plain) {bench_errors++;}
+}
+
+void benchFir(void)
+/*
+ * @BRIEF:          FIR filters of several lengths, with coefficients whose absolute values add
+ *                  up to less than 2, checked against a plain C convolution
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  FirQ15 fir;
+  uint32_t start;
+
+  for (uint32_t l = 0; l < FIR_LENGTHS; l++)
+  {
+    uint32_t taps = fir_taps[l];
+
+    for (uint32_t j = 0; j < taps; j++)
+    {
+      fir_coeffs[j] = (q15_t)(vec_b[j] / (int32_t)taps);
+    }
+
+    for (uint32_t k = 0; k < 2 * FILTER_BLOCK; k++)
+    {
+      int32_t acc = 0;
+
+      for (uint32_t j = 0; j < taps; j++)        /* x[k - (taps - 1 - j)], 0 before the start */
+      {
+        if (k + j + 1 >= taps) {acc += (int32_t)fir_coeffs[j] * vec_a[k + j + 1 - taps];}
+      }
+      filter_ref[k] = (q15_t)__SSAT(acc >> 15, 16);
+    }
+
+    firInit(&fir, fir_coeffs, taps, fir_state, FILTER_BLOCK);
+    firProcess(&fir, &vec_a[0], filter_out, FILTER_BLOCK);
+    for (uint32_t k = 0; k < FILTER_BLOCK; k++)
+    {
+      if (filter_out[k] != filter_ref[k]) {bench_errors++;}
+    }
+
+    start = DWT->CYCCNT;
+    firProcess(&fir, &vec_a[FILTER_BLOCK], filter_out, FILTER_BLOCK);
+    bench_fir_cycles_per_sample[l] = (DWT->CYCCNT - start) / FILTER_BLOCK;
+
+    for (uint32_t k = 0; k < FILTER_BLOCK; k++)
+    {
+      if (filter_out[k] != filter_ref[FILTER_BLOCK + k]) {bench_errors++;}
+    }
+  }
+}
+
+void benchBiquad(void)
+/*
+ * @BRIEF:          Biquad cascades of several lengths, checked against a plain C version
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  BiquadQ15 biquad;
+  uint32_t start;
+
+  for (uint32_t c = 0; c < BIQUAD_CASCADES; c++)
+  {
+    uint32_t stages = biquad_stages[c];
+
+    for (uint32_t k = 0; k < 2 * FILTER_BLOCK; k++) {filter_ref[k] = vec_a[k];}
+
+    for (uint32_t s = 0; s < stages; s++)
+    {
+      const q15_t *b = &biquad_coeffs[6 * s];
+      int32_t x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+
+      for (uint32_t k = 0; k < 2 * FILTER_BLOCK; k++)
+      {
+        int32_t x0 = filter_ref[k];
+        int64_t acc = (int64_t)b[0] * x0 + (int64_t)b[2] * x1 + (int64_t)b[3] * x2 +
+                      (int64_t)b[4] * y1 + (int64_t)b[5] * y2;
+
+        if (acc > INT32_MAX) {acc = INT32_MAX;}
+        else if (acc < INT32_MIN) {acc = INT32_MIN;}
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = __SSAT((int32_t)acc >> 14, 16);
+        filter_ref[k] = (q15_t)y1;
+      }
+    }
+
+    biquadInit(&biquad, biquad_coeffs, stages, 1, biquad_state);
+    biquadProcess(&biquad, &vec_a[0], filter_out, FILTER_BLOCK);
+    for (uint32_t k = 0; k < FILTER_BLOCK; k++)
+    {
+      if (filter_out[k] != filter_ref[k]) {bench_errors++;}
+    }
+
+    start = DWT->CYCCNT;
+    biquadProcess(&biquad, &vec_a[FILTER_BLOCK], filter_out, FILTER_BLOCK);
+    bench_biquad_cycles_per_sample[c] = (DWT->CYCCNT - start) / FILTER_BLOCK;
+
+    for (uint32_t k = 0; k < FILTER_BLOCK; k++)
+    {
+      if (filter_out[k] != filter_ref[FILTER_BLOCK + k]) {bench_errors++;}
+    }
+  }
+}
+
+void benchFft(void)
+/*
+ * @BRIEF:          Q15 and Q31 FFTs of a tone at half amplitude plus noise, read from the
+ *                  twiddle table at the bin points / 8 + 1
+ *
+ * @ARGUMENTS:      None
+ *
+ * @RETURNS:        None
+ */
+{
+  uint32_t start;
+
+  for (uint32_t f = 0; f < FFT_SIZES; f++)
+  {
+    volatile BenchFft *result = &bench_fft[f];
+    uint32_t points = 64U << f;
+    uint32_t bin = points / 8 + 1;
+
+    for (uint32_t i = 0; i < points; i++)
+    {
+      uint32_t phase = (bin * i * (FFT_MAX_POINTS / points)) % FFT_MAX_POINTS;
+
+      fft_q15[2 * i] = (q15_t)((fft_twiddle_q15[2 * phase] >> 1) + (vec_a[i % BENCH_SAMPLES] >> 4));
+      fft_q15[2 * i + 1] = 0;
+      fft_q31[2 * i] = q15ToQ31(fft_q15[2 * i]);
+      fft_q31[2 * i + 1] = 0;
+    }
+
+    start = DWT->CYCCNT;
+    fftQ15(fft_q15, points);
+    result->cycles_q15 = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    fftQ31(fft_q31, points);
+    result->cycles_q31 = DWT->CYCCNT - start;
+
+    result->points = points;
+    result->ram_q15 = 2 * points * sizeof(q15_t);
+    result->ram_q31 = 2 * points * sizeof(q31_t);
+
+    fftMagQ15(fft_q15, fft_mag_q15, points / 2 + 1);
+    fftMagQ31(fft_q31, fft_mag_q31, points / 2 + 1);
+    result->peak_q15 = fftPeakQ15(fft_mag_q15, 1, points / 2);
+    result->peak_q31 = fftPeakQ31(fft_mag_q31, 1, points / 2);
+
+    if (result->peak_q15 != bin || result->peak_q31 != bin) {bench_errors++;}
+
+    for (uint32_t i = 0; i < 2 * points; i++)
+    {
+      int32_t diff = fft_q15[i] - q31ToQ15(fft_q31[i]);
+
+      if (diff > FFT_TOLERANCE || diff < -FFT_TOLERANCE) {bench_errors++;}
+    }
+  }
+}
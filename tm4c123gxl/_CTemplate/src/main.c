@@ -13,6 +13,7 @@
  */
 
 #include <TM4C123GH6PM.h>
+#include "gpio.h"
 
 int main(void)
 {